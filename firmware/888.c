@@ -1,34 +1,16 @@
+#ifdef HOST_BUILD
+#include "host51.h" // native build for the host tools, see software/host
+#else
 #include <REG52.H>
 #include <intrins.h>
+#endif
 #define uchar unsigned char
 
 #define uint unsigned int
 
 uchar display[8][8];
 
-/*rank:A,1,2,3,4,I,,U*/
-
-uchar code table_cha[8][8]= {0x51,0x51,0x51,0x4a,0x4a,0x4a,0x44,0x44,0x18,0x1c,0x18,0x18,0x18,0x18,0x18,0x3c,0x3c,0x66,0x66,0x30,0x18,0xc,0x6,0xf6,0x3c,0x66,0x60,0x38,0x60,0x60,0x66,0x3c,0x30,0x38,0x3c,0x3e,0x36,0x7e,0x30,0x30,0x3c,0x3c,0x18,0x18,0x18,0x18,0x3c,0x3c,0x66,0xff,0xff,0xff,0x7e,0x3c,0x18,0x18,0x66,0x66,0x66,0x66,0x66,0x66,0x7e,0x3c};
-
-/*the "ideasoft"*/
-
-uchar code table_id[40]= {0x81,0xff,0x81,0x00,0xff,0x81,0x81,0x7e,0x00,0xff,0x89,0x89,0x00,0xf8,0x27,0x27,0xf8,0x00,0x8f,0x89,0x89,0xf9,0x00,0xff,0x81,0x81,0xff,0x00,0xff,0x09,0x09,0x09,0x01,0x0,0x01,0x01,0xff,0x01,0x01,0x00};
-
-/*railway*/
-
-uchar code dat[128]= {0x0,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0xc,0x8,0x4,0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,0x35,0x31,0x2d,0x29,0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x6f,0x8f,0x93,0x73,0x6f,0x8f,0x93,0x73,0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,0x35,0x31,0x2d,0x29,0x0,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0xc,0x8,0x4};
-
-/*railway 2*/
-
-uchar code dat2[28]= {0x0,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0xc,0x8,0x4};
-
-/*railway 3*/
-
-uchar code dat3[24]= {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x16,0x26,0x36,0x46,0x56,0x66,0x65,0x64,0x63,0x62,0x61,0x60,0x50,0x40,0x30,0x20,0x10};
-
-/*3p char*/
-
-uchar code table_3p[3][8]= {0xff,0x89,0xf5,0x93,0x93,0xf5,0x89,0xff,0x0e,0x1f,0x3f,0x7e,0x7e,0x3f,0x1f,0x0e,0x18,0x3c,0x7e,0xff,0x18,0x18,0x18,0x18};
+#include "888_assets.h" // code tables generated from assets/cube.assets
 
 /*initializtion
 
@@ -47,6 +29,7 @@ void sinter()
 	TR0=1;
 }
 
+#ifndef HOST_BUILD
 void delay5us(void)   // -0.026765046296us STC 1T 22.1184Mhz
 {
 	unsigned char a,b;
@@ -60,6 +43,7 @@ void delay(uint i)
 		delay5us();
 	}//12tmcu עʱ
 }
+#endif
 
 /*To judge the num bit*/
 
@@ -199,6 +183,10 @@ void line(uchar x1,uchar y1,uchar z1,uchar x2,uchar y2,uchar z2,uchar le)
 	a=x1*10;
 	b=y1*10;
 	c=z1*10;
+	if (t==0) {	// single point, do not divide by zero
+		point(x2,y2,z2,le);
+		return;
+	}
 	a1=a1*10/t;
 	b1=b1*10/t;
 	c1=c1*10/t;
@@ -1052,6 +1040,7 @@ void flash_11()
 	}
 }
 
+#ifndef HOST_BUILD
 void main()
 {
 	sinter();
@@ -1106,4 +1095,5 @@ void print() interrupt 1
 		layer=0;
 	TH0=0xc0;
 	TL0=0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,52 @@
+// generated by cubeasset from firmware/assets/cube.assets - do not edit
+
+/* glyphs: A 1 2 3 4 I heart U */
+uchar code table_cha[8][8] = {
+    0x51,0x51,0x51,0x4a,0x4a,0x4a,0x44,0x44,
+    0x18,0x1c,0x18,0x18,0x18,0x18,0x18,0x3c,
+    0x3c,0x66,0x66,0x30,0x18,0x0c,0x06,0xf6,
+    0x3c,0x66,0x60,0x38,0x60,0x60,0x66,0x3c,
+    0x30,0x38,0x3c,0x3e,0x36,0x7e,0x30,0x30,
+    0x3c,0x3c,0x18,0x18,0x18,0x18,0x3c,0x3c,
+    0x66,0xff,0xff,0xff,0x7e,0x3c,0x18,0x18,
+    0x66,0x66,0x66,0x66,0x66,0x66,0x7e,0x3c
+};
+
+/* banner */
+uchar code table_id[40] = {
+    0x81,0xff,0x81,0x00,0xff,0x81,0x81,0x7e,0x00,0xff,0x89,0x89,0x00,0xf8,0x27,0x27,
+    0xf8,0x00,0x8f,0x89,0x89,0xf9,0x00,0xff,0x81,0x81,0xff,0x00,0xff,0x09,0x09,0x09,
+    0x01,0x00,0x01,0x01,0xff,0x01,0x01,0x00
+};
+
+/* glyphs: 3p-0 3p-1 3p-2 */
+uchar code table_3p[3][8] = {
+    0xff,0x89,0xf5,0x93,0x93,0xf5,0x89,0xff,
+    0x0e,0x1f,0x3f,0x7e,0x7e,0x3f,0x1f,0x0e,
+    0x18,0x3c,0x7e,0xff,0x18,0x18,0x18,0x18
+};
+
+/* path railway */
+uchar code dat[128] = {
+    0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,
+    0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04,0x25,0x45,0x65,0x85,
+    0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,0x35,0x31,0x2d,0x29,
+    0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x6f,0x8f,0x93,0x73,
+    0x6f,0x8f,0x93,0x73,0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,
+    0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,
+    0x35,0x31,0x2d,0x29,0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,
+    0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04
+};
+
+/* path xy */
+uchar code dat2[28] = {
+    0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,
+    0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04
+};
+
+/* path nibble */
+uchar code dat3[24] = {
+    0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x16,0x26,0x36,0x46,0x56,0x66,0x65,0x64,0x63,
+    0x62,0x61,0x60,0x50,0x40,0x30,0x20,0x10
+};
+
@@ -0,0 +1,1102 @@
+// generated by cubepack - do not edit
+// 0: flash_2.raw
+// 1: flash_3.raw
+// 2: flash_4.raw
+// 3: flash_5.raw
+// 4: flash_6.raw
+// 5: flash_7.raw
+// 6: flash_8.raw
+// 7: flash_9.raw
+// 8: flash_10.raw
+// 9: flash_11.raw
+
+#define ANIM_COUNT 10
+#define ANIM_WINDOW 128   // decoder history bytes
+
+__code uchar anim[17270] = {
+    0x03,0x38,0x40,0x01,0x05,0x02,0xbd,0x40,0x03,0xb8,0x3e,0x82,0x40,0x02,0xbd,0x40,
+    0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0x3d,0x41,0x01,0x02,0x02,0x3e,
+    0x40,0x05,0x03,0x3e,0x40,0x0a,0x02,0x3e,0x40,0x14,0x03,0x3e,0x40,0x28,0x02,0x3e,
+    0x40,0x50,0x03,0x3e,0x40,0xa0,0x02,0x3d,0x41,0x80,0x40,0x03,0x3c,0x42,0x80,0x00,
+    0x80,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,
+    0x02,0x37,0x40,0x40,0x84,0x3e,0x03,0x37,0x40,0xa0,0x06,0x02,0x37,0x40,0x50,0x06,
+    0x02,0x37,0x40,0x28,0x06,0x03,0x37,0x40,0x14,0x06,0x02,0x37,0x40,0x0a,0x06,0x03,
+    0x37,0x40,0x05,0x06,0x02,0x31,0x40,0x02,0x88,0x05,0x01,0x03,0xb5,0x40,0x40,0x01,
+    0x06,0x02,0xb1,0x3e,0x89,0x7b,0x03,0xbd,0x40,0x02,0xbd,0x40,0x02,0x34,0x41,0x02,
+    0x04,0x08,0x03,0x35,0x40,0x0a,0x08,0x02,0x35,0x40,0x14,0x08,0x03,0x35,0x40,0x28,
+    0x08,0x02,0x35,0x40,0x50,0x08,0x03,0x34,0x41,0x40,0x20,0x08,0x02,0xb2,0x3e,0x80,
+    0x01,0x07,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0x30,0x40,0x20,0x8b,
+    0x3e,0x02,0x30,0x40,0x50,0x0d,0x03,0x30,0x40,0x28,0x0d,0x02,0x30,0x40,0x14,0x0d,
+    0x03,0x30,0x40,0x0a,0x0d,0x02,0x2a,0x40,0x04,0x88,0x05,0x08,0x02,0xae,0x40,0x40,
+    0x02,0x0d,0x03,0xaa,0x3e,0x90,0x7b,0x02,0x2b,0x41,0x04,0x08,0x11,0x03,0x2c,0x40,
+    0x14,0x11,0x02,0x2c,0x40,0x28,0x11,0x03,0x2b,0x41,0x20,0x10,0x11,0x02,0xa9,0x3e,
+    0x80,0x01,0x10,0x03,0xbd,0x3e,0x02,0x29,0x40,0x10,0x92,0x3e,0x02,0x29,0x40,0x28,
+    0x14,0x03,0x29,0x40,0x14,0x14,0x02,0x23,0x40,0x08,0x88,0x05,0x0f,0x03,0x23,0x40,
+    0x10,0x04,0x40,0x04,0x14,0x02,0xa1,0x3e,0x99,0x79,0x03,0x22,0x41,0x08,0x10,0x1a,
+    0x02,0x1b,0x84,0x77,0x9a,0x3e,0x03,0x15,0x8a,0x38,0x40,0x08,0x1b,0x02,0x99,0x3e,
+    0xa1,0x38,0x02,0x1a,0x41,0x08,0x10,0x22,0x03,0x12,0x40,0x04,0x06,0xa2,0x3e,0x02,
+    0x98,0x40,0x40,0x08,0x23,0x03,0x92,0x3e,0x40,0x04,0x29,0x02,0x92,0x40,0xa8,0x79,
+    0x03,0x14,0x40,0x14,0x29,0x02,0x14,0x40,0x28,0x29,0x02,0x13,0x41,0x20,0x10,0x29,
+    0x03,0x91,0x3e,0x80,0x01,0x28,0x02,0xbd,0x3e,0x03,0x11,0x40,0x10,0xaa,0x3e,0x02,
+    0x11,0x40,0x28,0x2c,0x03,0x11,0x40,0x14,0x2c,0x02,0x09,0x40,0x02,0x06,0x40,0x08,
+    0x2c,0x03,0x8f,0x40,0x40,0x04,0x2c,0x02,0x89,0x3e,0x40,0x02,0x32,0x02,0xbd,0x40,
+    0x03,0xbd,0x40,0x02,0x0c,0x41,0x02,0x04,0x30,0x03,0x0d,0x40,0x0a,0x30,0x02,0x0d,
+    0x40,0x14,0x30,0x03,0x0d,0x40,0x28,0x30,0x02,0x0d,0x40,0x50,0x30,0x03,0x0c,0x41,
+    0x40,0x20,0x30,0x02,0x8a,0x3e,0x80,0x01,0x2f,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,
+    0xbd,0x3e,0x03,0x08,0x40,0x20,0xb3,0x3e,0x02,0x08,0x40,0x50,0x35,0x03,0x08,0x40,
+    0x28,0x35,0x02,0x08,0x40,0x14,0x35,0x02,0x08,0x40,0x0a,0x35,0x03,0x00,0x40,0x01,
+    0x06,0x40,0x04,0x35,0x02,0x86,0x40,0x40,0x02,0x35,0x03,0x80,0x3e,0x40,0x01,0x3b,
+    0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0x05,0x41,0x01,
+    0x02,0x37,0x02,0x06,0x40,0x05,0x37,0x03,0x06,0x40,0x0a,0x37,0x02,0x06,0x40,0x14,
+    0x37,0x03,0x06,0x40,0x28,0x37,0x02,0x06,0x40,0x50,0x37,0x03,0x06,0x40,0xa0,0x37,
+    0x02,0x05,0x41,0x80,0x40,0x37,0x03,0x83,0x3e,0x80,0x01,0x36,0x02,0xbd,0x3e,0x02,
+    0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbc,0x3e,0x00,0x02,0x41,0x40,0x80,
+    0x3d,0x03,0x40,0xa0,0x3e,0x02,0x40,0x50,0x3e,0x02,0x40,0x28,0x3e,0x03,0x40,0x14,
+    0x3e,0x02,0x40,0x0a,0x3e,0x03,0x40,0x05,0x3e,0x02,0x40,0x02,0x3e,0x03,0x40,0x01,
+    0x3e,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,
+    0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0x06,0x40,0x02,0x37,0x03,0x06,0x40,0x04,0x37,
+    0x02,0x00,0x40,0x01,0x04,0x40,0x08,0x37,0x03,0x84,0x40,0x40,0x10,0x37,0x02,0x84,
+    0x40,0x40,0x20,0x37,0x02,0x84,0x40,0x40,0x40,0x37,0x03,0x84,0x40,0x40,0x80,0x37,
+    0x02,0x05,0x40,0x81,0x38,0x03,0x03,0x80,0x7d,0x40,0x01,0x37,0x02,0x83,0x3e,0x00,
+    0x40,0x02,0x37,0x03,0x83,0x3e,0x00,0x40,0x04,0x37,0x02,0x83,0x3e,0x00,0x40,0x08,
+    0x37,0x02,0x83,0x3e,0x00,0x40,0x10,0x37,0x03,0x40,0x80,0x05,0x40,0x20,0x37,0x02,
+    0x40,0x40,0x8a,0x06,0x31,0x03,0x84,0x78,0x40,0x80,0x37,0x02,0x40,0x10,0xbb,0x3e,
+    0x00,0x03,0x40,0x08,0xbb,0x3e,0x00,0x02,0x40,0x04,0xbb,0x3e,0x00,0x03,0x40,0x02,
+    0xbb,0x3e,0x00,0x02,0x40,0x01,0xbb,0x3e,0x00,0x02,0x87,0x3e,0x40,0x02,0x34,0x03,
+    0x86,0x3e,0xb4,0x40,0x02,0x40,0x40,0x00,0xbb,0x40,0x03,0x40,0x20,0x00,0xbb,0x40,
+    0x02,0x40,0x10,0x00,0xbb,0x40,0x03,0x40,0x08,0x0c,0x40,0x04,0x30,0x02,0x40,0x04,
+    0x98,0x4d,0x23,0x03,0x40,0x02,0x0c,0x40,0x10,0x30,0x02,0x40,0x01,0x0c,0x40,0x20,
+    0x30,0x02,0x09,0x40,0x02,0x02,0x40,0x40,0x30,0x03,0x8a,0x40,0xb0,0x3e,0x02,0x0b,
+    0x40,0x42,0x32,0x03,0x09,0x80,0x7d,0x40,0x02,0x31,0x02,0x89,0x3e,0x00,0xb0,0x40,
+    0x03,0x8a,0x3e,0x00,0x40,0x04,0x30,0x02,0x08,0x40,0x20,0x03,0x40,0x08,0x30,0x02,
+    0x08,0x40,0x10,0x86,0x04,0x2c,0x03,0x04,0x86,0x7a,0x40,0x20,0x30,0x02,0x08,0x40,
+    0x04,0x03,0x40,0x40,0x30,0x03,0x08,0x40,0x02,0xb3,0x3e,0x02,0x07,0x88,0x7d,0x40,
+    0x04,0x2b,0x03,0x8f,0x3e,0xab,0x40,0x02,0x90,0x3e,0xaa,0x40,0x03,0x91,0x3e,0x00,
+    0x40,0x08,0x29,0x02,0x08,0x40,0x20,0x0a,0x40,0x10,0x29,0x02,0x92,0x33,0x40,0x20,
+    0x29,0x03,0x08,0x40,0x08,0xb3,0x3e,0x02,0x08,0x40,0x04,0xb3,0x3e,0x03,0x08,0x40,
+    0x02,0xb3,0x3e,0x02,0x11,0x41,0x10,0x04,0x2b,0x03,0x11,0x40,0x08,0x00,0xa9,0x40,
+    0x02,0x10,0x81,0x3d,0xa8,0x40,0x03,0x14,0x40,0x08,0x8a,0x06,0x1c,0x02,0x14,0x40,
+    0x10,0x8a,0x06,0x1c,0x02,0x14,0x40,0x20,0xa7,0x3e,0x03,0x97,0x3e,0x00,0x40,0x08,
+    0x23,0x02,0x97,0x3e,0x03,0x9f,0x48,0x03,0xa0,0x3e,0x00,0x40,0x10,0x1a,0x02,0x00,
+    0x9f,0x2d,0x9a,0x3e,0x03,0x11,0x40,0x08,0x9e,0x10,0x0b,0x02,0x11,0x40,0x04,0xaa,
+    0x18,0x02,0x0b,0x9d,0x78,0x91,0x40,0x03,0x1b,0x40,0x10,0x00,0x9f,0x40,0x02,0xa9,
+    0x3e,0x00,0x40,0x08,0x11,0x03,0x09,0xa0,0x2d,0x40,0x10,0x11,0x02,0xaa,0x48,0x40,
+    0x20,0x11,0x03,0x12,0x96,0x76,0x91,0x3e,0x02,0xbd,0x3e,0x03,0x22,0x40,0x08,0x99,
+    0x3e,0x02,0x29,0x41,0x10,0x04,0x13,0x02,0x29,0x40,0x08,0x00,0x91,0x40,0x03,0x28,
+    0x81,0x3d,0x90,0x40,0x02,0x2c,0x40,0x08,0x03,0x40,0x02,0x0c,0x03,0x2c,0x40,0x10,
+    0x00,0x8e,0x40,0x02,0x2c,0x40,0x20,0x00,0x8e,0x40,0x03,0xb0,0x3e,0x8a,0x40,0x02,
+    0xb1,0x3e,0x89,0x40,0x03,0xb2,0x3e,0x00,0x40,0x04,0x08,0x02,0x29,0x40,0x10,0x0a,
+    0x40,0x08,0x08,0x02,0x1e,0x94,0x33,0x87,0x4b,0x03,0x29,0x40,0x04,0x0a,0x40,0x20,
+    0x08,0x02,0x31,0x40,0x02,0x02,0x40,0x40,0x08,0x03,0xb2,0x40,0x88,0x3e,0x02,0x33,
+    0x40,0x42,0x0a,0x03,0x31,0x80,0x7d,0x40,0x02,0x09,0x02,0xb1,0x3e,0x00,0x88,0x40,
+    0x02,0xb2,0x3e,0x00,0x40,0x04,0x08,0x03,0x30,0x40,0x20,0x03,0x40,0x08,0x08,0x02,
+    0x30,0x40,0x10,0x86,0x04,0x04,0x03,0x2c,0x86,0x7a,0x40,0x20,0x08,0x02,0x30,0x40,
+    0x04,0x03,0x40,0x40,0x08,0x03,0x30,0x40,0x02,0x8b,0x3e,0x02,0x2f,0x86,0x7d,0x40,
+    0x01,0x05,0x03,0xb5,0x3e,0x85,0x40,0x02,0xb6,0x3e,0x84,0x40,0x02,0xb7,0x3e,0x83,
+    0x40,0x03,0x30,0x40,0x20,0x00,0x8a,0x40,0x02,0x30,0x40,0x10,0x00,0x8a,0x40,0x03,
+    0x30,0x40,0x08,0x00,0x8a,0x40,0x02,0x30,0x40,0x04,0x0c,0x40,0x02,0x03,0x23,0x98,
+    0x31,0x40,0x04,0x02,0x38,0x40,0x01,0x04,0x40,0x08,0x03,0x00,0xbb,0x40,0x40,0x10,
+    0x02,0x00,0xbb,0x40,0x40,0x20,0x02,0x00,0xbb,0x40,0x40,0x40,0x03,0x00,0xbb,0x40,
+    0x40,0x80,0x02,0x3d,0x40,0x81,0x00,0x03,0x3b,0x80,0x7d,0x40,0x01,0x02,0xbb,0x3e,
+    0x00,0x40,0x02,0x03,0xbb,0x3e,0x00,0x40,0x04,0x02,0xbb,0x3e,0x00,0x40,0x08,0x02,
+    0xbb,0x3e,0x00,0x40,0x10,0x03,0xbb,0x3e,0x00,0x40,0x20,0x02,0x37,0x40,0x40,0x84,
+    0x06,0x03,0x31,0x8a,0x78,0x40,0x80,0x02,0x37,0x40,0x10,0x84,0x3e,0x03,0x37,0x40,
+    0x08,0x84,0x3e,0x02,0x37,0x40,0x04,0x84,0x3e,0x03,0x37,0x40,0x02,0x84,0x3e,0x02,
+    0x37,0x40,0x01,0x84,0x3e,0x02,0x36,0x86,0x7d,0x03,0xbd,0x3e,0x02,0x37,0x40,0x40,
+    0x06,0x03,0x37,0x40,0x20,0x06,0x02,0x37,0x40,0x10,0x06,0x03,0x37,0x40,0x08,0x06,
+    0x02,0x37,0x40,0x04,0x06,0x03,0x37,0x40,0x02,0x06,0x02,0x37,0x40,0x01,0x06,0x02,
+    0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,
+    0x40,0x02,0xbd,0x40,0x02,0x3e,0x40,0x02,0x03,0x3e,0x40,0x04,0x02,0x3e,0x40,0x08,
+    0x03,0x3e,0x40,0x10,0x02,0x3e,0x40,0x20,0x03,0x3e,0x40,0x40,0x02,0x3e,0x40,0x80,
+    0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,
+    0xbd,0x3e,0x02,0xbd,0x3e,0x03,0x37,0x40,0x40,0x06,0x02,0x37,0x40,0x20,0x06,0x03,
+    0x37,0x40,0x10,0x06,0x02,0x37,0x40,0x08,0x06,0x02,0x37,0x40,0x04,0x06,0x03,0x37,
+    0x40,0x02,0x06,0x02,0x37,0x40,0x01,0x06,0x03,0xbd,0x79,0x02,0xbd,0x40,0x03,0xbd,
+    0x40,0x02,0xbd,0x40,0x02,0xbd,0x40,0x03,0x35,0x40,0x04,0x08,0x02,0x35,0x40,0x08,
+    0x08,0x03,0x35,0x40,0x10,0x08,0x02,0x35,0x40,0x20,0x08,0x03,0x35,0x40,0x40,0x08,
+    0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,
+    0x30,0x40,0x20,0x0d,0x03,0x30,0x40,0x10,0x0d,0x02,0x30,0x40,0x08,0x0d,0x03,0x30,
+    0x40,0x04,0x0d,0x02,0x30,0x40,0x02,0x0d,0x03,0xbd,0x79,0x02,0xbd,0x40,0x02,0xbd,
+    0x40,0x03,0x2c,0x40,0x08,0x11,0x02,0x2c,0x40,0x10,0x11,0x03,0x2c,0x40,0x20,0x11,
+    0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,0x29,0x40,0x10,0x14,0x03,0x29,
+    0x40,0x08,0x14,0x02,0x29,0x40,0x04,0x14,0x03,0xbd,0x79,0x02,0x23,0x40,0x10,0x1a,
+    0x03,0xbd,0x3e,0x02,0x22,0x40,0x08,0x1b,0x03,0xbd,0x38,0x02,0x1b,0x40,0x10,0x22,
+    0x02,0xbd,0x3e,0x03,0x1a,0x40,0x08,0x23,0x02,0x12,0x40,0x04,0x2b,0x03,0xbd,0x40,
+    0x02,0xbd,0x40,0x03,0x14,0x40,0x08,0x29,0x02,0x14,0x40,0x10,0x29,0x03,0x14,0x40,
+    0x20,0x29,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0x11,0x40,0x10,0x2c,
+    0x03,0x11,0x40,0x08,0x2c,0x02,0x11,0x40,0x04,0x2c,0x03,0x09,0x40,0x02,0x34,0x02,
+    0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0x0d,0x40,0x04,0x30,
+    0x02,0x0d,0x40,0x08,0x30,0x03,0x0d,0x40,0x10,0x30,0x03,0x0d,0x40,0x20,0x30,0x03,
+    0x0d,0x40,0x40,0x30,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,
+    0x03,0xbd,0x3e,0x02,0x08,0x40,0x20,0x35,0x03,0x08,0x40,0x10,0x35,0x02,0x08,0x40,
+    0x08,0x35,0x03,0x08,0x40,0x04,0x35,0x02,0x08,0x40,0x02,0x35,0x02,0x00,0x40,0x01,
+    0x3d,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,
+    0x02,0xbd,0x40,0x02,0x06,0x40,0x02,0x37,0x03,0x06,0x40,0x04,0x37,0x02,0x06,0x40,
+    0x08,0x37,0x03,0x06,0x40,0x10,0x37,0x02,0x06,0x40,0x20,0x37,0x03,0x06,0x40,0x40,
+    0x37,0x02,0x06,0x40,0x80,0x37,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,0xbd,0x3e,0x03,
+    0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0x40,0x80,0x3e,0x03,0x40,0x40,0x3e,
+    0x02,0x40,0x20,0x3e,0x03,0x40,0x10,0x3e,0x02,0x40,0x08,0x3e,0x02,0x40,0x04,0x3e,
+    0x03,0x40,0x02,0x3e,0x1b,0x40,0x01,0x3e,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,
+    0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0x06,0x40,
+    0x02,0x37,0x03,0x06,0x40,0x04,0x37,0x02,0x06,0x40,0x08,0x37,0x03,0x06,0x40,0x10,
+    0x37,0x02,0x06,0x40,0x20,0x37,0x02,0x06,0x40,0x40,0x37,0x03,0x06,0x40,0x80,0x37,
+    0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x02,
+    0xbd,0x3e,0x03,0x40,0x80,0x3e,0x02,0x40,0x40,0x3e,0x03,0x40,0x20,0x3e,0x02,0x40,
+    0x10,0x3e,0x03,0x40,0x08,0x3e,0x02,0x40,0x04,0x3e,0x03,0x40,0x02,0x3e,0x02,0x40,
+    0x01,0x3e,0x02,0x09,0x40,0x02,0x34,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,
+    0x02,0xbd,0x40,0x03,0x0d,0x40,0x04,0x30,0x02,0x0d,0x40,0x08,0x30,0x03,0x0d,0x40,
+    0x10,0x30,0x02,0x0d,0x40,0x20,0x30,0x02,0x0d,0x40,0x40,0x30,0x03,0xbd,0x3e,0x02,
+    0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0x08,0x40,0x20,0x35,
+    0x02,0x08,0x40,0x10,0x35,0x03,0x08,0x40,0x08,0x35,0x02,0x08,0x40,0x04,0x35,0x03,
+    0x08,0x40,0x02,0x35,0x02,0x12,0x40,0x04,0x2b,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,
+    0x14,0x40,0x08,0x29,0x02,0x14,0x40,0x10,0x29,0x02,0x14,0x40,0x20,0x29,0x03,0xbd,
+    0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0x11,0x40,0x10,0x2c,0x03,0x11,0x40,0x08,
+    0x2c,0x02,0x11,0x40,0x04,0x2c,0x03,0x1b,0x40,0x08,0x22,0x02,0x1b,0x40,0x10,0x22,
+    0x02,0xbd,0x3e,0x03,0x1a,0x40,0x08,0x23,0x02,0xbd,0x48,0x03,0x23,0x40,0x10,0x1a,
+    0x02,0xbd,0x3e,0x03,0x22,0x40,0x08,0x1b,0x02,0x2a,0x40,0x04,0x13,0x02,0xbd,0x40,
+    0x03,0xbd,0x40,0x02,0x2c,0x40,0x08,0x11,0x03,0x2c,0x40,0x10,0x11,0x02,0x2c,0x40,
+    0x20,0x11,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0x29,0x40,0x10,0x14,
+    0x02,0x29,0x40,0x08,0x14,0x03,0x29,0x40,0x04,0x14,0x02,0x31,0x40,0x02,0x0c,0x03,
+    0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,0x03,0x35,0x40,0x04,0x08,
+    0x02,0x35,0x40,0x08,0x08,0x02,0x35,0x40,0x10,0x08,0x03,0x35,0x40,0x20,0x08,0x02,
+    0x35,0x40,0x40,0x08,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,
+    0x02,0xbd,0x3e,0x03,0x30,0x40,0x20,0x0d,0x02,0x30,0x40,0x10,0x0d,0x03,0x30,0x40,
+    0x08,0x0d,0x02,0x30,0x40,0x04,0x0d,0x03,0x30,0x40,0x02,0x0d,0x02,0x38,0x40,0x01,
+    0x05,0x03,0xbd,0x40,0x02,0xbd,0x40,0x02,0xbd,0x40,0x03,0xbd,0x40,0x02,0xbd,0x40,
+    0x03,0xbd,0x40,0x02,0x3e,0x40,0x02,0x03,0x3e,0x40,0x04,0x02,0x3e,0x40,0x08,0x03,
+    0x3e,0x40,0x10,0x02,0x3e,0x40,0x20,0x02,0x3e,0x40,0x40,0x03,0x3e,0x40,0x80,0x02,
+    0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x03,0xbd,0x3e,0x02,0xbd,0x3e,0x15,0xbd,
+    0x3e,0x00,0x07,0x40,0xff,0xbc,0x07,0x06,0x41,0xff,0xff,0xbb,0x07,0x06,0xbd,0x40,
+    0x06,0xbd,0x40,0x06,0xbd,0x40,0x06,0xbd,0x40,0x06,0xbd,0x40,0x0c,0xbd,0x40,0x06,
+    0xbd,0x07,0x07,0xbd,0x3e,0x06,0xbd,0x3e,0x06,0xbd,0x3e,0x06,0xbd,0x3e,0x06,0xbd,
+    0x3e,0x0c,0xbc,0x3e,0x00,0x06,0xbd,0x07,0x06,0xbd,0x40,0x06,0xbd,0x40,0x07,0xbd,
+    0x40,0x06,0xbd,0x40,0x06,0xbd,0x40,0x06,0xbd,0x40,0x00,0x05,0x06,0x40,0xff,0x37,
+    0x05,0x05,0x41,0xff,0xff,0xb5,0x47,0x04,0x8c,0x3e,0xae,0x47,0x05,0x8b,0x35,0xaf,
+    0x47,0x04,0x8a,0x2c,0xb0,0x47,0x05,0x89,0x23,0xb1,0x47,0x05,0x88,0x1a,0xb2,0x47,
+    0x04,0x87,0x11,0xb3,0x08,0x05,0xbd,0x47,0x04,0x07,0xb5,0x47,0x05,0x07,0xb5,0x47,
+    0x04,0x06,0xb6,0x47,0x05,0x05,0xb7,0x47,0x05,0x04,0xb8,0x47,0x0d,0x03,0xb9,0x47,
+    0x05,0x85,0x07,0x37,0x04,0x85,0x40,0xb5,0x47,0x05,0x86,0x39,0xb4,0x47,0x05,0x87,
+    0x32,0xb3,0x47,0x04,0x88,0x2b,0xb2,0x47,0x05,0x89,0x24,0xb1,0x47,0x04,0xad,0x40,
+    0x8d,0x47,0x05,0xbd,0x47,0x04,0xbd,0x47,0x05,0x01,0xbb,0x47,0x05,0x02,0xba,0x47,
+    0x04,0x03,0xb9,0x47,0x05,0x04,0xb8,0x47,0x12,0x05,0xb7,0x47,0x00,0x05,0x06,0x40,
+    0xff,0x06,0x40,0x81,0xac,0x07,0x40,0xff,0x05,0x05,0x41,0xff,0xff,0x84,0x16,0x85,
+    0x07,0x40,0xc3,0x9c,0x07,0x86,0x37,0x04,0x8c,0x3e,0x40,0x7e,0x84,0x26,0x85,0x07,
+    0x40,0x66,0x8c,0x07,0x40,0x7e,0x8a,0x27,0x80,0x37,0x05,0x94,0x3e,0x40,0x3c,0x84,
+    0x36,0x8c,0x07,0x84,0x17,0x88,0x3e,0x04,0x9c,0x3e,0x40,0x18,0x8a,0x07,0x90,0x3e,
+    0x05,0x0a,0x41,0x7e,0x7e,0x05,0x40,0x42,0x82,0x26,0x80,0x07,0x83,0x36,0x87,0x07,
+    0x84,0x17,0x85,0x27,0x04,0x05,0x12,0x41,0x3c,0x3c,0x05,0x40,0x24,0x83,0x36,0x86,
+    0x07,0x85,0x17,0x0c,0x04,0x1a,0x41,0x18,0x18,0x8b,0x07,0x14,0x05,0xbd,0x3e,0x04,
+    0x11,0x41,0x3c,0x3c,0x04,0x42,0x18,0x3c,0x24,0x8a,0x07,0x85,0x17,0x0e,0x05,0x09,
+    0x41,0x7e,0x7e,0x04,0x42,0x3c,0x7e,0x42,0x83,0x36,0x40,0x66,0x8a,0x07,0x85,0x17,
+    0x86,0x27,0x06,0x04,0xbd,0x3f,0x05,0x11,0x41,0x3c,0x3c,0x00,0x83,0x38,0x40,0x24,
+    0x8a,0x07,0x85,0x17,0x0e,0x05,0x19,0x41,0x18,0x18,0x8b,0x07,0x15,0x04,0xbd,0x40,
+    0x05,0x12,0x41,0x3c,0x3c,0x05,0x42,0x24,0x3c,0x18,0x8a,0x07,0x85,0x17,0x0c,0x04,
+    0x0a,0x41,0x7e,0x7e,0x05,0x41,0x42,0x7e,0x83,0x28,0x41,0x42,0x66,0x83,0x38,0x86,
+    0x07,0x84,0x17,0x85,0x27,0x04,0x05,0xbd,0x3f,0x04,0x12,0x41,0x3c,0x3c,0x05,0x40,
+    0x24,0x83,0x36,0x86,0x07,0x85,0x17,0x0c,0x05,0x1a,0x41,0x18,0x18,0x8b,0x07,0x14,
+    0x05,0xbd,0x3e,0x04,0x11,0x41,0x3c,0x3c,0x04,0x42,0x18,0x3c,0x24,0x8a,0x07,0x85,
+    0x17,0x0e,0x05,0x09,0x41,0x7e,0x7e,0x04,0x42,0x3c,0x7e,0x42,0x83,0x36,0x40,0x66,
+    0x8a,0x07,0x85,0x17,0x86,0x27,0x06,0x04,0x01,0x41,0xff,0xff,0x05,0x41,0x81,0x81,
+    0xab,0x07,0x83,0x37,0x05,0x85,0x06,0x85,0x07,0x42,0x3c,0xff,0xc3,0x04,0x41,0x24,
+    0xe7,0x8b,0x07,0x85,0x17,0x8d,0x2f,0x04,0x8c,0x0e,0x00,0x41,0xc3,0xc3,0x9b,0x07,
+    0x8d,0x2f,0x05,0x17,0x41,0x18,0x18,0x8b,0x07,0x17,0x05,0x0f,0x41,0x3c,0x3c,0x05,
+    0x42,0x24,0x3c,0x18,0x8a,0x07,0x85,0x17,0x0f,0x04,0x07,0x41,0x7e,0x7e,0x05,0x41,
+    0x42,0x7e,0x83,0x28,0x41,0x42,0x66,0x83,0x38,0x86,0x07,0x84,0x17,0x85,0x27,0x07,
+    0x05,0x41,0xff,0xff,0x05,0x41,0x81,0xff,0x83,0x18,0x41,0x81,0xc3,0x82,0x28,0x80,
+    0x07,0x83,0x38,0x87,0x07,0x84,0x17,0x84,0x27,0x85,0x37,0x04,0xbd,0x40,0x05,0xbd,
+    0x40,0x04,0xbd,0x40,0x05,0x9c,0x40,0x40,0x24,0x8b,0x07,0x8f,0x40,0x05,0x94,0x40,
+    0x40,0x42,0x9b,0x07,0x87,0x40,0x04,0x8c,0x40,0x40,0x81,0xaa,0x07,0x80,0x37,0x00,
+    0x04,0x3d,0x40,0xff,0x00,0x03,0xbd,0x3e,0x03,0xbd,0x3e,0x03,0xbd,0x3e,0x03,0xbd,
+    0x3e,0x03,0xbd,0x3e,0x03,0xbd,0x3e,0x03,0xbd,0x37,0x03,0xba,0x37,0x80,0x15,0x03,
+    0xb3,0x37,0x87,0x1c,0x03,0xb0,0x1a,0x8a,0x23,0x03,0xa1,0x13,0x99,0x3e,0x03,0x92,
+    0x0c,0xa8,0x3e,0x03,0xaf,0x37,0x8b,0x70,0x03,0x86,0x07,0xb4,0x3e,0x03,0xad,0x40,
+    0x8d,0x2d,0x03,0x93,0x12,0xa7,0x24,0x03,0xb9,0x1b,0x03,0x03,0x95,0x24,0x40,0xff,
+    0x26,0x03,0x8d,0x2d,0x40,0xff,0x2e,0x04,0x06,0x41,0xff,0xff,0x36,0x03,0x8c,0x37,
+    0xae,0x46,0x03,0x94,0x31,0xa6,0x47,0x03,0x9c,0x2a,0x9e,0x47,0x03,0xbd,0x23,0x03,
+    0x9e,0x1c,0x9c,0x2a,0x03,0x98,0x15,0xa2,0x47,0x03,0x92,0x0e,0xa8,0x47,0x03,0x8c,
+    0x07,0xae,0x3e,0x03,0x9d,0x10,0x9d,0x3e,0x03,0xae,0x19,0x8c,0x24,0x03,0xb8,0x22,
+    0x82,0x1b,0x03,0x02,0xb4,0x6a,0x83,0x12,0x03,0x03,0xb2,0x47,0x84,0x09,0x03,0x02,
+    0xb2,0x47,0x85,0x3e,0x03,0xae,0x38,0x8c,0x0e,0x03,0xb4,0x37,0x86,0x15,0x03,0xb3,
+    0x37,0x87,0x1c,0x03,0xb0,0x1a,0x8a,0x23,0x03,0xa1,0x13,0x99,0x3e,0x04,0x92,0x0c,
+    0xa8,0x3e,0x03,0xaf,0x37,0x8b,0x70,0x03,0x86,0x07,0xb4,0x3e,0x03,0xad,0x40,0x8d,
+    0x2d,0x03,0x93,0x12,0xa7,0x24,0x03,0xb9,0x1b,0x03,0x03,0x95,0x24,0x40,0xff,0x26,
+    0x03,0x8d,0x2d,0x40,0xff,0x2e,0x03,0x06,0x41,0xff,0xff,0x36,0x01,0x0e,0x40,0x01,
+    0x2f,0x02,0x94,0x3f,0xa6,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0x06,0xb6,0x56,0x02,0xa2,0x56,0x1a,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,0xb7,0x56,
+    0x01,0xa1,0x56,0x1b,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,0x56,0x02,0x9f,
+    0x56,0x1d,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0x02,0xba,0x56,0x01,0x9e,0x56,0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0x01,0xbb,0x56,0x01,0x9d,0x56,0x1f,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0x00,0xbc,0x56,0x02,0x9c,0x56,0x20,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0e,0x40,0x02,0x2f,0x01,0x94,0x3f,0xa6,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,
+    0x04,0xb8,0x54,0x01,0x9e,0x54,0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x00,0xbc,0x53,0x02,0x99,0x53,0x23,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0e,0x40,
+    0x04,0x2f,0x01,0x94,0x3f,0xa6,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,0xb7,0x55,0x01,0xa0,0x55,0x1c,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,
+    0x55,0x02,0x9e,0x55,0x1e,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0x02,0xba,0x56,0x01,0x9e,0x56,0x1e,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x01,0xbb,0x56,0x01,
+    0x9d,0x56,0x1f,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0x00,0xbc,0x56,0x02,0x9c,0x56,0x20,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0e,0x40,0x08,0x2f,0x01,0x94,
+    0x3f,0xa6,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0x06,0xb6,0x56,0x01,0xa2,0x56,0x1a,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,0x54,0x02,0x9d,0x54,
+    0x1f,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0x00,0xbc,0x54,0x01,0x9a,0x54,0x22,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0e,0x40,0x10,0x2f,0x01,0x94,0x3f,0xa6,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0x06,0xb6,0x56,0x02,0xa2,0x56,0x1a,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,0xb9,0x54,0x02,0x9d,0x54,0x1f,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x00,
+    0xbc,0x54,0x01,0x9a,0x54,0x22,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0x0e,0x40,0x20,0x2f,0x02,0x94,0x3f,0xa6,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,
+    0xb7,0x55,0x02,0xa0,0x55,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,0xb9,0x55,0x01,0x9e,0x55,0x1e,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x02,0xba,0x56,
+    0x02,0x9e,0x56,0x1e,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0x01,0xbb,0x56,0x02,0x9d,0x56,0x1f,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x00,0xbc,0x56,0x01,0x9c,
+    0x56,0x20,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0x0e,0x40,0x40,0x2f,0x02,0x94,0x3f,0xa6,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x54,0x02,0x9e,
+    0x54,0x1e,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0x00,0xbc,0x53,0x01,0x99,0x53,0x23,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x0e,0x40,0x80,0x2f,0x02,0x94,0x3f,
+    0xa6,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0x06,0xb6,0x56,0x02,0xa2,0x56,0x1a,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,0xb7,0x56,0x01,0xa1,0x56,0x1b,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,0x56,0x02,0x9f,0x56,0x1d,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x02,0xba,
+    0x56,0x01,0x9e,0x56,0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0x01,0xbb,0x56,0x02,0x9d,0x56,0x1f,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x00,0xbc,0x56,0x02,
+    0x9c,0x56,0x20,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x05,0x37,0x47,0x80,0xf7,0xf7,0xe3,0xa2,0xf7,0xd5,0x80,0x04,0x37,0x47,
+    0x40,0x7b,0x7b,0x71,0x51,0x7b,0x6a,0x40,0x05,0x37,0x47,0x20,0x3d,0x3d,0x38,0x28,
+    0x3d,0x35,0x20,0x05,0x37,0x47,0x10,0x1e,0x1e,0x1c,0x14,0x1e,0x1a,0x10,0x04,0x37,
+    0x47,0x08,0x0f,0x0f,0x0e,0x0a,0x0f,0x0d,0x08,0x05,0x37,0x47,0x04,0x07,0x07,0x07,
+    0x05,0x07,0x06,0x04,0x04,0x37,0x44,0x02,0x03,0x03,0x03,0x02,0x80,0x02,0x05,0x37,
+    0x40,0x01,0x84,0x00,0x01,0x8c,0x15,0x30,0x02,0x93,0x3f,0xa7,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x05,0xb7,0x56,
+    0x02,0xa1,0x56,0x1b,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0x04,0xb8,0x56,0x01,0xa0,0x56,0x1c,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x0e,0x40,0x02,0x2f,0x02,
+    0x94,0x3f,0xa6,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0x06,0xb6,0x56,0x02,0xa2,0x56,0x1a,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,0xb7,0x56,0x01,0xa1,
+    0x56,0x1b,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,0x56,0x02,0x9f,0x56,0x1d,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0x0e,0x40,0x04,0x2f,0x01,0x94,0x3f,0xa6,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x06,0xb6,0x56,0x02,0xa2,0x56,0x1a,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0x05,0xb7,0x56,0x02,0xa1,0x56,0x1b,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x04,0xb8,0x56,0x01,0xa0,0x56,0x1c,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0x03,0xb9,
+    0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0x02,0xba,0x56,0x02,0x9e,0x56,0x1e,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0d,0x40,0x08,0x30,
+    0x01,0x93,0x3f,0xa7,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x02,0x05,0xb7,0x56,0x01,0xa1,0x56,0x1b,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,0x02,
+    0xa0,0x56,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0x03,0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x02,0xba,0x56,0x01,0x9e,0x56,
+    0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0x01,0xbb,0x56,0x02,0x9d,0x56,0x1f,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0d,0x40,0x10,0x30,0x01,0x93,0x3f,0xa7,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0x05,0xb7,0x56,0x01,0xa1,0x56,0x1b,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,
+    0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0x02,0xba,0x56,0x01,0x9e,0x56,0x1e,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x01,0xbb,0x56,
+    0x02,0x9d,0x56,0x1f,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0x0e,0x40,0x20,0x2f,0x01,0x94,0x3f,0xa6,0x47,0x02,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x06,0xb6,0x56,
+    0x01,0xa2,0x56,0x1a,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0x05,0xb7,0x56,0x02,0xa1,0x56,0x1b,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x04,0xb8,0x56,0x02,0xa0,
+    0x56,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0x03,0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x02,0xba,0x56,0x02,0x9e,0x56,0x1e,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0x0e,0x40,0x40,0x2f,0x02,0x94,0x3f,0xa6,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x06,0xb6,0x56,0x01,0xa2,0x56,0x1a,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,
+    0x05,0xb7,0x56,0x02,0xa1,0x56,0x1b,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,0xb9,
+    0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0x0d,0x40,0x80,0x30,0x02,0x93,0x3f,0xa7,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0x05,0xb7,
+    0x56,0x02,0xa1,0x56,0x1b,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0x04,0xb8,0x56,0x01,0xa0,0x56,0x1c,0x02,0xbd,0x47,0x01,
+    0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x04,0x38,0x46,0x14,0x22,
+    0x41,0x80,0x80,0x80,0x55,0x05,0x38,0x46,0x0a,0x11,0x20,0x40,0x40,0x40,0x2a,0x05,
+    0x38,0x46,0x05,0x08,0x10,0x20,0x20,0x20,0x15,0x04,0x38,0x46,0x02,0x04,0x08,0x10,
+    0x10,0x10,0x0a,0x05,0x38,0x40,0x01,0x80,0x40,0x42,0x08,0x08,0x05,0x04,0x00,0xb9,
+    0x40,0x42,0x04,0x04,0x02,0x05,0x00,0xb9,0x40,0x42,0x02,0x02,0x01,0x04,0x3b,0x42,
+    0x01,0x01,0x01,0x00,0x02,0x0b,0xb1,0x4c,0x02,0x91,0x3f,0xa9,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,0xb9,0x56,
+    0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0x0c,0x40,0x02,0x31,0x02,0x92,0x3f,0xa8,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,
+    0x02,0xa0,0x56,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0x03,0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x02,0xba,0x56,0x02,0x9e,
+    0x56,0x1e,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0x0d,0x40,0x04,0x30,0x02,0x93,0x3f,0xa7,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x05,0xb7,0x56,0x01,0xa1,
+    0x56,0x1b,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x03,0xb9,0x56,0x02,0x9f,0x56,0x1d,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0x02,0xba,0x56,0x01,0x9e,0x56,0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x01,0xbb,0x56,0x02,0x9d,0x56,0x1f,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x0e,0x40,
+    0x08,0x2f,0x02,0x94,0x3f,0xa6,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x06,0xb6,0x56,0x01,0xa2,0x56,0x1a,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x05,0xb7,
+    0x56,0x02,0xa1,0x56,0x1b,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0x04,0xb8,0x56,0x02,0xa0,0x56,0x1c,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x03,0xb9,0x56,0x01,
+    0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,
+    0xbd,0x47,0x01,0x02,0xba,0x56,0x02,0x9e,0x56,0x1e,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x01,0xbb,0x56,0x02,0x9d,0x56,
+    0x1f,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0x00,0xbc,0x56,0x01,0x9c,0x56,0x20,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x02,0x0b,0x40,0x10,0x32,0x01,0x91,0x3f,0xa9,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0x03,0xb9,0x56,0x02,0x9f,0x56,0x1d,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0b,0x40,0x20,0x32,0x01,0x91,0x3f,0xa9,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x02,0x03,0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0x0b,0x40,0x40,0x32,0x02,0x91,0x3f,0xa9,
+    0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,
+    0x02,0x03,0xb9,0x56,0x01,0x9f,0x56,0x1d,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0x0b,0x40,0x80,0x32,0x01,0x91,0x3f,0xa9,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x02,0xbd,0x47,
+    0x01,0x03,0xb9,0x56,0x02,0x9f,0x56,0x1d,0x01,0xbd,0x47,0x02,0xbd,0x47,0x01,0xbd,
+    0x47,0x02,0xbd,0x47,0x01,0xbd,0x47,0x05,0x37,0x47,0x0c,0x0a,0x09,0x80,0x80,0x09,
+    0x0a,0x0c,0x05,0x37,0x47,0x06,0x05,0x04,0x40,0x40,0x04,0x05,0x06,0x04,0x37,0x47,
+    0x03,0x02,0x02,0x20,0x20,0x02,0x02,0x03,0x05,0x37,0x44,0x01,0x01,0x01,0x10,0x10,
+    0x80,0x04,0x04,0x3a,0x41,0x08,0x08,0x02,0x05,0x3a,0x41,0x04,0x04,0x02,0x04,0x3a,
+    0x41,0x02,0x02,0x02,0x05,0x3a,0x41,0x01,0x01,0x02,0x00,0x04,0x0e,0x40,0xff,0x2f,
+    0x03,0xbd,0x47,0x03,0xbd,0x47,0x03,0xbd,0x47,0x03,0xbd,0x47,0x03,0xbd,0x47,0x03,
+    0xbd,0x47,0x03,0xbd,0x3e,0x03,0x9d,0x10,0x9d,0x3e,0x03,0xae,0x19,0x8c,0x24,0x03,
+    0xb8,0x22,0x82,0x1b,0x03,0x02,0xb4,0x6a,0x83,0x12,0x03,0x03,0xb2,0x47,0x84,0x09,
+    0x03,0x02,0xb2,0x47,0x85,0x3e,0x03,0xae,0x38,0x8c,0x0e,0x03,0xb4,0x37,0x86,0x15,
+    0x03,0xb3,0x37,0x87,0x1c,0x03,0xb0,0x1a,0x8a,0x23,0x03,0xa1,0x13,0x99,0x3e,0x03,
+    0x92,0x0c,0xa8,0x3e,0x04,0xaf,0x37,0x8b,0x70,0x03,0x86,0x07,0xb4,0x3e,0x03,0xad,
+    0x40,0x8d,0x2d,0x03,0x93,0x12,0xa7,0x24,0x03,0xb9,0x1b,0x03,0x03,0x95,0x24,0x40,
+    0xff,0x26,0x03,0x8d,0x2d,0x40,0xff,0x2e,0x03,0x06,0x41,0xff,0xff,0x36,0x03,0x8c,
+    0x37,0xae,0x46,0x03,0x94,0x31,0xa6,0x47,0x03,0x9c,0x2a,0x9e,0x47,0x03,0xbd,0x23,
+    0x03,0x9e,0x1c,0x9c,0x2a,0x03,0x98,0x15,0xa2,0x47,0x03,0x92,0x0e,0xa8,0x47,0x03,
+    0x8c,0x07,0xae,0x3e,0x03,0x9d,0x10,0x9d,0x3e,0x03,0xae,0x19,0x8c,0x24,0x03,0xb8,
+    0x22,0x82,0x1b,0x03,0x02,0xb4,0x6a,0x83,0x12,0x04,0x03,0xb2,0x47,0x84,0x09,0x03,
+    0x02,0xb2,0x47,0x85,0x3e,0x03,0xae,0x38,0x8c,0x0e,0x03,0xb4,0x37,0x86,0x15,0x03,
+    0xb3,0x37,0x87,0x1c,0x03,0xb0,0x1a,0x8a,0x23,0x03,0xa1,0x13,0x99,0x3e,0x03,0x92,
+    0x0c,0xa8,0x3e,0x03,0xaf,0x37,0x8b,0x70,0x03,0x86,0x07,0xb4,0x3e,0x03,0xad,0x40,
+    0x8d,0x2d,0x03,0x93,0x12,0xa7,0x24,0x03,0xb9,0x1b,0x03,0x03,0x95,0x24,0x40,0xff,
+    0x26,0x03,0x8d,0x2d,0x40,0xff,0x2e,0x03,0x06,0x41,0xff,0xff,0x36,0x03,0x8c,0x37,
+    0xae,0x46,0x03,0x94,0x31,0xa6,0x47,0x03,0x9c,0x2a,0x9e,0x47,0x03,0xbd,0x23,0x04,
+    0x9e,0x1c,0x9c,0x2a,0x03,0x98,0x15,0xa2,0x47,0x03,0x92,0x0e,0xa8,0x47,0x03,0x8c,
+    0x07,0xae,0x3e,0x03,0x9d,0x10,0x9d,0x3e,0x03,0xae,0x19,0x8c,0x24,0x03,0xb8,0x22,
+    0x82,0x1b,0x03,0x02,0xb4,0x6a,0x83,0x12,0x03,0x03,0xb2,0x47,0x84,0x09,0x03,0x02,
+    0xb2,0x47,0x85,0x3e,0x03,0xae,0x38,0x8c,0x0e,0x03,0xb4,0x37,0x86,0x15,0x03,0xb3,
+    0x37,0x87,0x1c,0x03,0xb0,0x1a,0x8a,0x23,0x03,0xa1,0x13,0x99,0x3e,0x03,0x92,0x0c,
+    0xa8,0x3e,0x03,0xaf,0x37,0x8b,0x70,0x03,0x41,0x80,0x01,0xbb,0x07,0x03,0x42,0x40,
+    0x00,0x01,0xba,0x07,0x03,0x40,0x20,0x00,0x83,0x08,0xb5,0x07,0x04,0x40,0x10,0x00,
+    0x83,0x08,0xb5,0x07,0x03,0x40,0x08,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x04,0x00,
+    0x83,0x08,0xb5,0x07,0x03,0x40,0x02,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x01,0x05,
+    0x40,0x02,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x04,0xb5,0x07,0x03,0x00,0x83,0x08,
+    0x40,0x08,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x10,0xb5,0x07,0x03,0x00,0x83,0x08,
+    0x40,0x20,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x40,0xb5,0x07,0x03,0x05,0x41,0x01,
+    0x80,0xb5,0x07,0x03,0x05,0x41,0x80,0x01,0xb5,0x07,0x03,0x04,0x42,0x80,0x00,0x02,
+    0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x04,0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x08,
+    0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x10,0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x20,
+    0xb5,0x07,0x03,0x40,0x80,0x05,0x40,0x40,0xb5,0x07,0x03,0x40,0x40,0x05,0x40,0x80,
+    0xb5,0x07,0x03,0x40,0x20,0x83,0x06,0x00,0xb5,0x07,0x04,0x40,0x10,0x83,0x06,0xb6,
+    0x07,0x03,0x40,0x08,0x83,0x06,0xb6,0x07,0x03,0x40,0x04,0x83,0x06,0xb6,0x07,0x03,
+    0x40,0x02,0x83,0x06,0xb6,0x07,0x03,0x40,0x01,0x83,0x06,0xb6,0x07,0x03,0x41,0x80,
+    0x01,0xbb,0x07,0x03,0x42,0x40,0x00,0x01,0xba,0x07,0x03,0x40,0x20,0x00,0x83,0x08,
+    0xb5,0x07,0x03,0x40,0x10,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x08,0x00,0x83,0x08,
+    0xb5,0x07,0x03,0x40,0x04,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x02,0x00,0x83,0x08,
+    0xb5,0x07,0x03,0x40,0x01,0x05,0x40,0x02,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x04,
+    0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x08,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x10,
+    0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x20,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x40,
+    0xb5,0x07,0x03,0x05,0x41,0x01,0x80,0xb5,0x07,0x03,0x05,0x41,0x80,0x01,0xb5,0x07,
+    0x04,0x04,0x42,0x80,0x00,0x02,0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x04,0xb5,0x07,
+    0x03,0x83,0x06,0x00,0x40,0x08,0xb5,0x07,0x03,0x83,0x06,0x00,0x40,0x10,0xb5,0x07,
+    0x03,0x83,0x06,0x00,0x40,0x20,0xb5,0x07,0x03,0x40,0x80,0x05,0x40,0x40,0xb5,0x07,
+    0x03,0x40,0x40,0x05,0x40,0x80,0xb5,0x07,0x03,0x40,0x20,0x83,0x06,0x00,0xb5,0x07,
+    0x03,0x40,0x10,0x83,0x06,0xb6,0x07,0x03,0x40,0x08,0x83,0x06,0xb6,0x07,0x03,0x40,
+    0x04,0x83,0x06,0xb6,0x07,0x03,0x40,0x02,0x83,0x06,0xb6,0x07,0x04,0x40,0x01,0x83,
+    0x06,0xb6,0x07,0x01,0x00,0x40,0x7f,0xbb,0x07,0x01,0x01,0x40,0x3f,0xba,0x07,0x01,
+    0x02,0x40,0x1f,0xb9,0x07,0x01,0x03,0x40,0x0f,0xb8,0x07,0x01,0x04,0x40,0x07,0xb7,
+    0x07,0x01,0x05,0x40,0x03,0xb6,0x07,0x0b,0x06,0x40,0x01,0xb5,0x07,0x01,0x42,0xc0,
+    0x40,0x20,0x01,0x42,0x08,0x0c,0x06,0xb5,0x07,0x01,0x40,0x20,0x80,0x06,0x43,0x10,
+    0x10,0x00,0x08,0xb5,0x07,0x01,0x40,0x10,0x80,0x00,0x81,0x09,0xb5,0x07,0x01,0x41,
+    0x08,0x08,0x04,0x40,0x20,0xb5,0x07,0x01,0x40,0x04,0x00,0x80,0x08,0x42,0x20,0x20,
+    0x40,0xb5,0x07,0x0b,0x41,0x02,0x04,0x03,0x41,0x40,0x80,0xb5,0x07,0x01,0x41,0x01,
+    0x02,0x82,0x06,0x00,0xb5,0x07,0x01,0x00,0x43,0x01,0x04,0x00,0x60,0x80,0x06,0xb5,
+    0x07,0x01,0x01,0x41,0x03,0x10,0x82,0x06,0xb4,0x07,0x01,0x02,0x40,0xcf,0x00,0xb8,
+    0x07,0x01,0x01,0x42,0x80,0x20,0x03,0xb8,0x07,0x0b,0x46,0x80,0xc0,0x60,0x00,0x04,
+    0x03,0x01,0xb6,0x07,0x01,0x41,0x40,0x20,0x02,0x42,0x04,0x02,0x01,0xb5,0x07,0x01,
+    0x42,0x20,0x00,0x10,0x82,0x08,0xb5,0x07,0x01,0x40,0x10,0x80,0x06,0x43,0x08,0x08,
+    0x00,0x04,0xb5,0x07,0x01,0x40,0x08,0x81,0x00,0x80,0x09,0xb5,0x07,0x01,0x41,0x04,
+    0x04,0x80,0x47,0x01,0x40,0x10,0xb5,0x07,0x01,0x40,0x02,0x00,0x80,0x08,0x42,0x10,
+    0x10,0x20,0xb5,0x07,0x0b,0x41,0x01,0x02,0x03,0x41,0x20,0x40,0xb5,0x07,0x01,0x00,
+    0x82,0x08,0x41,0x40,0x80,0xb5,0x07,0x01,0x01,0x43,0x01,0x04,0x00,0x60,0x80,0x06,
+    0xb4,0x07,0x01,0x02,0x41,0x03,0x10,0x82,0x06,0xb3,0x07,0x01,0x03,0x40,0xdf,0x00,
+    0xb7,0x07,0x01,0x02,0x42,0x80,0x30,0x03,0xb7,0x07,0x0b,0x00,0x46,0x80,0xc0,0x60,
+    0x00,0x04,0x03,0x01,0xb5,0x07,0x01,0x41,0x80,0x40,0x02,0x42,0x08,0x04,0x02,0xb5,
+    0x07,0x01,0x42,0x40,0x00,0x20,0x82,0x08,0xb5,0x07,0x01,0x40,0x20,0x80,0x06,0x43,
+    0x10,0x10,0x00,0x08,0xb5,0x07,0x01,0x40,0x10,0x80,0x00,0x81,0x09,0xb5,0x07,0x01,
+    0x41,0x08,0x08,0x04,0x40,0x20,0xb5,0x07,0x01,0x40,0x04,0x00,0x80,0x08,0x42,0x20,
+    0x20,0x40,0xb5,0x07,0x0b,0x41,0x02,0x04,0x03,0x41,0x40,0x80,0xb5,0x07,0x01,0x41,
+    0x01,0x02,0x82,0x06,0x00,0xb5,0x07,0x01,0x00,0x43,0x01,0x04,0x00,0x60,0x80,0x06,
+    0xb5,0x07,0x01,0x01,0x41,0x03,0x10,0x82,0x06,0xb4,0x07,0x01,0x02,0x40,0xcf,0x00,
+    0xb8,0x07,0x01,0x00,0x44,0x80,0xc0,0x20,0x07,0x01,0xb7,0x07,0x0b,0x42,0x80,0x40,
+    0x20,0x01,0x41,0x02,0x01,0xb6,0x07,0x01,0x81,0x06,0x00,0x42,0x04,0x02,0x01,0xb5,
+    0x07,0x01,0x42,0x20,0x00,0x10,0x82,0x08,0xb5,0x07,0x01,0x40,0x10,0x80,0x06,0x43,
+    0x08,0x08,0x00,0x04,0xb5,0x07,0x01,0x40,0x08,0x81,0x00,0x80,0x09,0xb5,0x07,0x01,
+    0x41,0x04,0x04,0x80,0x47,0x01,0x40,0x10,0xb5,0x07,0x01,0x40,0x02,0x00,0x80,0x08,
+    0x42,0x10,0x10,0x20,0xb5,0x07,0x0b,0x41,0x01,0x02,0x03,0x41,0x20,0x40,0xb5,0x07,
+    0x01,0x00,0x82,0x08,0x41,0x40,0x80,0xb5,0x07,0x01,0x01,0x43,0x01,0x04,0x00,0x60,
+    0x80,0x06,0xb4,0x07,0x01,0x02,0x41,0x03,0x10,0x82,0x06,0xb3,0x07,0x01,0x02,0x42,
+    0x80,0xef,0x03,0xb7,0x07,0x01,0x01,0x44,0x80,0x40,0x00,0x04,0x01,0xb6,0x07,0x01,
+    0x80,0x06,0x40,0x20,0x01,0x41,0x02,0x01,0xb5,0x07,0x01,0x40,0x80,0x06,0xb5,0x07,
+    0x01,0x41,0x40,0x40,0xbb,0x07,0x01,0x42,0x20,0x20,0x20,0xba,0x07,0x01,0x40,0x10,
+    0x80,0x00,0xb9,0x07,0x01,0x40,0x08,0x81,0x00,0xb8,0x07,0x01,0x40,0x04,0x82,0x00,
+    0xb7,0x07,0x01,0x40,0x02,0x83,0x00,0xb6,0x07,0x00,0x04,0x40,0x02,0xbc,0x00,0x03,
+    0x40,0x06,0xbc,0x00,0x03,0x44,0x0c,0x0c,0x0c,0x08,0x08,0x80,0x04,0x88,0x07,0x9d,
+    0x00,0x8a,0x2f,0x03,0x44,0x18,0x18,0x18,0x10,0x10,0x80,0x04,0xb5,0x07,0x03,0x44,
+    0x30,0x30,0x30,0x20,0x20,0x80,0x04,0xb5,0x07,0x03,0x44,0x60,0x60,0x60,0x40,0x40,
+    0x80,0x04,0x88,0x07,0x9d,0x00,0x8a,0x2f,0x03,0x40,0xc0,0xbc,0x00,0x27,0x40,0x80,
+    0xbc,0x00,0x04,0x40,0x02,0x87,0x00,0x41,0x03,0x03,0x93,0x07,0x9a,0x00,0x03,0x42,
+    0x06,0x06,0x06,0x01,0x80,0x04,0x88,0x07,0x41,0x04,0x04,0x93,0x07,0x85,0x00,0x82,
+    0x34,0x85,0x07,0x03,0x42,0x0c,0x0c,0x0c,0x01,0x80,0x04,0xa8,0x07,0x41,0x04,0x04,
+    0x88,0x07,0x03,0x45,0x18,0x18,0x18,0x08,0x08,0x18,0x82,0x00,0x01,0xb0,0x07,0x03,
+    0x45,0x30,0x30,0x30,0x10,0x10,0x30,0x82,0x00,0x01,0x83,0x07,0x41,0x20,0x20,0x9b,
+    0x07,0x01,0x88,0x07,0x03,0x44,0x60,0x60,0x60,0x40,0x40,0x80,0x04,0xa8,0x07,0x8a,
+    0x00,0x03,0x44,0xc0,0xc0,0xc0,0x80,0x80,0x80,0x04,0xa0,0x07,0x92,0x00,0x27,0x40,
+    0x80,0x87,0x00,0x01,0x93,0x07,0x9a,0x00,0x04,0x42,0x02,0x02,0x02,0x01,0x40,0x02,
+    0x82,0x00,0x41,0x01,0x01,0x93,0x07,0x85,0x1f,0x92,0x00,0x03,0x42,0x06,0x06,0x06,
+    0x01,0x80,0x04,0xa8,0x07,0x42,0x04,0x04,0x06,0x87,0x00,0x03,0x45,0x0c,0x0c,0x0c,
+    0x08,0x08,0x0c,0x82,0x00,0x01,0xb0,0x07,0x03,0x40,0x18,0x87,0x00,0x41,0x08,0x08,
+    0xa3,0x07,0x01,0x88,0x07,0x03,0x44,0x30,0x30,0x30,0x10,0x10,0x80,0x04,0xa8,0x07,
+    0x41,0x20,0x20,0x88,0x07,0x03,0x42,0x60,0x60,0x60,0x01,0x80,0x04,0xa0,0x07,0x41,
+    0x40,0x40,0x90,0x07,0x03,0x45,0xc0,0xc0,0xc0,0x80,0x80,0xc0,0x82,0x00,0x01,0x93,
+    0x07,0x85,0x1f,0x8d,0x07,0x82,0x00,0x27,0x40,0x80,0xbc,0x00,0x00,0x04,0x40,0x01,
+    0xbc,0x00,0x03,0x40,0x03,0xbc,0x00,0x03,0x40,0x06,0xbc,0x00,0x03,0x40,0x0c,0xbc,
+    0x00,0x03,0x40,0x18,0xbc,0x00,0x03,0x40,0x30,0xbc,0x00,0x03,0x40,0x60,0xbc,0x00,
+    0x03,0x40,0xc0,0xbc,0x00,0x03,0x40,0x40,0x05,0x40,0x80,0xb5,0x07,0x03,0x40,0x20,
+    0x83,0x06,0x00,0xb5,0x07,0x03,0x40,0x10,0x83,0x06,0xb6,0x07,0x03,0x40,0x08,0x83,
+    0x06,0xb6,0x07,0x03,0x40,0x04,0x83,0x06,0xb6,0x07,0x03,0x40,0x02,0x83,0x06,0xb6,
+    0x07,0x03,0x40,0x01,0x83,0x06,0xb6,0x07,0x03,0x41,0x80,0x01,0xbb,0x07,0x03,0x42,
+    0x40,0x00,0x01,0xba,0x07,0x03,0x40,0x20,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x10,
+    0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x08,0x00,0x83,0x08,0xb5,0x07,0x04,0x40,0x04,
+    0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x02,0x00,0x83,0x08,0xb5,0x07,0x03,0x40,0x01,
+    0x05,0x40,0x02,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x04,0xb5,0x07,0x03,0x00,0x83,
+    0x08,0x40,0x08,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x10,0xb5,0x07,0x03,0x00,0x83,
+    0x08,0x40,0x20,0xb5,0x07,0x03,0x00,0x83,0x08,0x40,0x40,0xb5,0x07,0x03,0x05,0x41,
+    0x01,0x80,0xb5,0x07,0x03,0x05,0x41,0x40,0x01,0xb5,0x07,0x03,0x04,0x42,0x20,0x00,
+    0x02,0xb5,0x07,0x03,0x03,0x40,0x10,0x01,0x40,0x04,0xb5,0x07,0x03,0x02,0x40,0x08,
+    0xb9,0x03,0x03,0x8b,0x4a,0xaf,0x07,0x03,0x00,0x40,0x02,0x04,0x40,0x20,0xb5,0x07,
+    0x06,0x40,0x01,0x05,0x40,0x40,0xb5,0x07,0x02,0x42,0x03,0x06,0x0c,0x02,0x41,0x60,
+    0xc0,0x37,0x01,0x82,0x3e,0x42,0x30,0x00,0x60,0xb5,0x47,0x02,0x43,0x0c,0x00,0x18,
+    0x18,0x01,0x41,0x30,0x30,0xb5,0x47,0x01,0x80,0x3d,0x40,0x18,0x81,0x00,0xb5,0x47,
+    0x02,0x40,0x30,0x01,0x80,0x37,0x41,0x0c,0x0c,0xb5,0x47,0x01,0x41,0x60,0x30,0x80,
+    0x41,0x42,0x0c,0x00,0x06,0xb5,0x47,0x02,0x41,0xc0,0x60,0x03,0x41,0x06,0x03,0xb5,
+    0x47,0x02,0x47,0x80,0xc0,0x60,0x20,0x00,0x02,0x03,0x01,0xb5,0x47,0x01,0x80,0x40,
+    0x43,0x40,0x04,0x05,0x01,0xb6,0x47,0x02,0x01,0x43,0x80,0xb0,0x33,0x03,0x01,0xb5,
+    0x47,0x01,0x02,0x41,0xdf,0xdf,0x02,0xb5,0x47,0x02,0x01,0x43,0x03,0x13,0x90,0x80,
+    0x01,0xb5,0x47,0x01,0x00,0x44,0x01,0x05,0x04,0x60,0xe0,0x81,0x40,0xb3,0x47,0x02,
+    0x42,0x01,0x03,0x02,0x01,0x42,0x40,0xc0,0x80,0xb5,0x47,0x01,0x41,0x03,0x06,0x03,
+    0x41,0x60,0xc0,0xb5,0x47,0x02,0x42,0x06,0x00,0x0c,0x01,0x42,0x30,0x30,0x60,0xb5,
+    0x47,0x01,0x40,0x0c,0x80,0x3e,0x40,0x18,0x80,0x41,0xb5,0x47,0x02,0x40,0x18,0x81,
+    0x00,0x80,0x05,0xb5,0x47,0x01,0x41,0x30,0x30,0x01,0x80,0x40,0x40,0x0c,0xb5,0x47,
+    0x02,0x42,0x60,0x00,0x30,0x02,0x41,0x0c,0x06,0xb5,0x47,0x01,0x41,0xc0,0x60,0x82,
+    0x3e,0x40,0x03,0xb5,0x47,0x02,0x42,0x80,0xc0,0x40,0x01,0x42,0x02,0x03,0x01,0xb5,
+    0x47,0x01,0x00,0x45,0x80,0xa0,0x20,0x06,0x07,0x01,0x00,0xb5,0x47,0x02,0x01,0x43,
+    0xc0,0xc8,0x09,0x01,0x01,0xb5,0x47,0x01,0x02,0x41,0xfb,0xfb,0x02,0xb5,0x47,0x02,
+    0x01,0x43,0x01,0x0d,0xcc,0xc0,0x01,0xb5,0x47,0x02,0x00,0x45,0x01,0x03,0x02,0x20,
+    0xa0,0x80,0x00,0xb5,0x47,0x01,0x47,0x01,0x03,0x06,0x04,0x00,0x40,0xc0,0x80,0xb5,
+    0x47,0x02,0x42,0x03,0x06,0x0c,0x02,0x41,0x60,0xc0,0xb5,0x47,0x01,0x82,0x3e,0x42,
+    0x30,0x00,0x60,0xb5,0x47,0x02,0x43,0x0c,0x00,0x18,0x18,0x01,0x41,0x30,0x30,0xb5,
+    0x47,0x01,0x80,0x3d,0x40,0x18,0x81,0x00,0xb5,0x47,0x02,0x40,0x30,0x01,0x80,0x37,
+    0x41,0x0c,0x0c,0xb5,0x47,0x01,0x41,0x60,0x30,0x80,0x41,0x42,0x0c,0x00,0x06,0xb5,
+    0x47,0x02,0x41,0xc0,0x60,0x03,0x41,0x06,0x03,0xb5,0x47,0x01,0x47,0x80,0xc0,0x60,
+    0x20,0x00,0x02,0x03,0x01,0xb5,0x47,0x02,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,0x01,
+    0x00,0xb5,0x47,0x01,0x01,0x43,0x80,0xb0,0x33,0x03,0x01,0xb5,0x47,0x02,0x02,0x41,
+    0xdf,0xdf,0x02,0xb5,0x47,0x01,0x01,0x43,0x03,0x13,0x90,0x80,0x01,0xb5,0x47,0x02,
+    0x00,0x44,0x01,0x05,0x04,0x60,0xe0,0x81,0x40,0xb3,0x47,0x01,0x42,0x01,0x03,0x02,
+    0x01,0x42,0x40,0xc0,0x80,0xb5,0x47,0x02,0x41,0x03,0x06,0x03,0x41,0x60,0xc0,0xb5,
+    0x47,0x01,0x42,0x06,0x00,0x0c,0x01,0x42,0x30,0x30,0x60,0xb5,0x47,0x02,0x40,0x0c,
+    0x80,0x3e,0x40,0x18,0x80,0x41,0xb5,0x47,0x01,0x40,0x18,0x81,0x00,0x80,0x05,0xb5,
+    0x47,0x02,0x41,0x30,0x30,0x01,0x80,0x40,0x40,0x0c,0xb5,0x47,0x02,0x42,0x60,0x00,
+    0x30,0x02,0x41,0x0c,0x06,0xb5,0x47,0x01,0x41,0xc0,0x60,0x82,0x3e,0x40,0x03,0xb5,
+    0x47,0x02,0x42,0x80,0xc0,0x40,0x01,0x42,0x02,0x03,0x01,0xb5,0x47,0x01,0x00,0x45,
+    0x80,0xa0,0x20,0x06,0x07,0x01,0x00,0xb5,0x47,0x02,0x01,0x43,0xc0,0xc8,0x09,0x01,
+    0x01,0xb5,0x47,0x01,0x02,0x41,0xfb,0xfb,0x02,0xb5,0x47,0x02,0x01,0x43,0x01,0x0d,
+    0xcc,0xc0,0x01,0xb5,0x47,0x01,0x00,0x45,0x01,0x03,0x02,0x20,0xa0,0x80,0x00,0xb5,
+    0x47,0x02,0x47,0x01,0x03,0x06,0x04,0x00,0x40,0xc0,0x80,0xb5,0x47,0x01,0x42,0x03,
+    0x06,0x0c,0x02,0x41,0x60,0xc0,0xb5,0x47,0x02,0x82,0x3e,0x42,0x30,0x00,0x60,0xb5,
+    0x47,0x01,0x43,0x0c,0x00,0x18,0x18,0x01,0x41,0x30,0x30,0xb5,0x47,0x02,0x80,0x3d,
+    0x40,0x18,0x81,0x00,0xb5,0x47,0x01,0x40,0x30,0x01,0x80,0x37,0x41,0x0c,0x0c,0xb5,
+    0x47,0x02,0x41,0x60,0x30,0x80,0x41,0x42,0x0c,0x00,0x06,0xb5,0x47,0x01,0x41,0xc0,
+    0x60,0x03,0x41,0x06,0x03,0xb5,0x47,0x02,0x47,0x80,0xc0,0x60,0x20,0x00,0x02,0x03,
+    0x01,0xb5,0x47,0x01,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,0x01,0x00,0xb5,0x47,0x02,
+    0x01,0x43,0x80,0xb0,0x33,0x03,0x01,0xb5,0x47,0x02,0x02,0x41,0xdf,0xdf,0x02,0xb5,
+    0x47,0x01,0x01,0x43,0x03,0x13,0x90,0x80,0x01,0xb5,0x47,0x02,0x00,0x44,0x01,0x05,
+    0x04,0x60,0xe0,0x81,0x40,0xb3,0x47,0x01,0x42,0x01,0x03,0x02,0x01,0x42,0x40,0xc0,
+    0x80,0xb5,0x47,0x02,0x07,0xb5,0x47,0x01,0x07,0xb5,0x47,0x02,0x07,0xb5,0x47,0x01,
+    0x06,0xb6,0x47,0x02,0x05,0xb7,0x47,0x01,0x04,0xb8,0x47,0x0e,0x05,0xb7,0x47,0x01,
+    0x85,0x07,0x37,0x02,0x00,0x45,0x01,0x05,0x04,0x60,0xe0,0x80,0x00,0xb5,0x47,0x02,
+    0x01,0x43,0x03,0x13,0x90,0x80,0xb7,0x47,0x01,0x02,0x41,0xdf,0xdf,0xb8,0x47,0x02,
+    0x01,0x43,0x80,0xb0,0x33,0x03,0xb7,0x47,0x01,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,
+    0x01,0xb6,0x47,0x02,0x47,0x80,0xc0,0x60,0x20,0x00,0x02,0x03,0x01,0xb5,0x47,0x01,
+    0x41,0xc0,0x60,0x03,0x41,0x06,0x03,0xb5,0x47,0x02,0x42,0x60,0x30,0x30,0x01,0x42,
+    0x0c,0x00,0x06,0xb5,0x47,0x01,0x80,0x3d,0x40,0x18,0x01,0x41,0x0c,0x0c,0xb5,0x47,
+    0x02,0x41,0x18,0x18,0x80,0x02,0x80,0x00,0xb5,0x47,0x01,0x40,0x0c,0x80,0x3e,0x01,
+    0x41,0x30,0x30,0xb5,0x47,0x02,0x41,0x06,0x0c,0x02,0x42,0x30,0x00,0x60,0xb5,0x47,
+    0x01,0x40,0x03,0x82,0x40,0x41,0x60,0xc0,0xb5,0x47,0x02,0x47,0x01,0x03,0x06,0x04,
+    0x00,0x40,0xc0,0x80,0xb5,0x47,0x01,0x00,0x45,0x01,0x03,0x02,0x20,0xa0,0x80,0x00,
+    0xb5,0x47,0x02,0x01,0x43,0x01,0x0d,0xcc,0xc0,0x01,0xb5,0x47,0x01,0x02,0x41,0xfb,
+    0xfb,0x02,0xb5,0x47,0x02,0x01,0x43,0xc0,0xc8,0x09,0x01,0x01,0xb5,0x47,0x01,0x00,
+    0x44,0x80,0xa0,0x20,0x06,0x07,0x81,0x40,0xb3,0x47,0x02,0x42,0x80,0xc0,0x40,0x01,
+    0x42,0x02,0x03,0x01,0xb5,0x47,0x02,0x41,0xc0,0x60,0x02,0x42,0x0c,0x06,0x03,0xb5,
+    0x47,0x01,0x42,0x60,0x00,0x30,0x82,0x40,0xb5,0x47,0x02,0x40,0x30,0x80,0x3e,0x43,
+    0x18,0x18,0x00,0x0c,0xb5,0x47,0x01,0x40,0x18,0x81,0x00,0x80,0x05,0xb5,0x47,0x02,
+    0x41,0x0c,0x0c,0x80,0x37,0x01,0x40,0x30,0xb5,0x47,0x01,0x40,0x06,0x00,0x80,0x40,
+    0x42,0x30,0x30,0x60,0xb5,0x47,0x02,0x41,0x03,0x06,0x03,0x41,0x60,0xc0,0xb5,0x47,
+    0x01,0x42,0x01,0x03,0x02,0x01,0x42,0x40,0xc0,0x80,0xb5,0x47,0x02,0x00,0x45,0x01,
+    0x05,0x04,0x60,0xe0,0x80,0x00,0xb5,0x47,0x01,0x01,0x43,0x03,0x13,0x90,0x80,0x01,
+    0xb5,0x47,0x02,0x02,0x41,0xdf,0xdf,0x02,0xb5,0x47,0x01,0x01,0x43,0x80,0xb0,0x33,
+    0x03,0x01,0xb5,0x47,0x02,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,0x01,0x00,0xb5,0x47,
+    0x01,0x47,0x80,0xc0,0x60,0x20,0x00,0x02,0x03,0x01,0xb5,0x47,0x02,0x41,0xc0,0x60,
+    0x03,0x41,0x06,0x03,0xb5,0x47,0x01,0x42,0x60,0x30,0x30,0x01,0x42,0x0c,0x00,0x06,
+    0xb5,0x47,0x02,0x80,0x3d,0x40,0x18,0x01,0x41,0x0c,0x0c,0xb5,0x47,0x01,0x41,0x18,
+    0x18,0x80,0x02,0x80,0x00,0xb5,0x47,0x02,0x40,0x0c,0x80,0x3e,0x01,0x41,0x30,0x30,
+    0xb5,0x47,0x01,0x41,0x06,0x0c,0x02,0x42,0x30,0x00,0x60,0xb5,0x47,0x02,0x40,0x03,
+    0x82,0x40,0x41,0x60,0xc0,0xb5,0x47,0x02,0x47,0x01,0x03,0x06,0x04,0x00,0x40,0xc0,
+    0x80,0xb5,0x47,0x01,0x00,0x45,0x01,0x03,0x02,0x20,0xa0,0x80,0x00,0xb5,0x47,0x02,
+    0x01,0x43,0x01,0x0d,0xcc,0xc0,0x01,0xb5,0x47,0x01,0x02,0x41,0xfb,0xfb,0x02,0xb5,
+    0x47,0x02,0x01,0x43,0xc0,0xc8,0x09,0x01,0x01,0xb5,0x47,0x01,0x00,0x44,0x80,0xa0,
+    0x20,0x06,0x07,0x81,0x40,0xb3,0x47,0x02,0x42,0x80,0xc0,0x40,0x01,0x42,0x02,0x03,
+    0x01,0xb5,0x47,0x01,0x41,0xc0,0x60,0x02,0x42,0x0c,0x06,0x03,0xb5,0x47,0x02,0x42,
+    0x60,0x00,0x30,0x82,0x40,0xb5,0x47,0x01,0x40,0x30,0x80,0x3e,0x43,0x18,0x18,0x00,
+    0x0c,0xb5,0x47,0x02,0x40,0x18,0x81,0x00,0x80,0x05,0xb5,0x47,0x01,0x41,0x0c,0x0c,
+    0x80,0x37,0x01,0x40,0x30,0xb5,0x47,0x02,0x40,0x06,0x00,0x80,0x40,0x42,0x30,0x30,
+    0x60,0xb5,0x47,0x01,0x41,0x03,0x06,0x03,0x41,0x60,0xc0,0xb5,0x47,0x02,0x42,0x01,
+    0x03,0x02,0x01,0x42,0x40,0xc0,0x80,0xb5,0x47,0x01,0x00,0x45,0x01,0x05,0x04,0x60,
+    0xe0,0x80,0x00,0xb5,0x47,0x02,0x01,0x43,0x03,0x13,0x90,0x80,0x01,0xb5,0x47,0x01,
+    0x02,0x41,0xdf,0xdf,0x02,0xb5,0x47,0x02,0x01,0x43,0x80,0xb0,0x33,0x03,0x01,0xb5,
+    0x47,0x02,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,0x01,0x00,0xb5,0x47,0x01,0x47,0x80,
+    0xc0,0x60,0x20,0x00,0x02,0x03,0x01,0xb5,0x47,0x02,0x41,0xc0,0x60,0x03,0x41,0x06,
+    0x03,0xb5,0x47,0x01,0x42,0x60,0x30,0x30,0x01,0x42,0x0c,0x00,0x06,0xb5,0x47,0x02,
+    0x80,0x3d,0x40,0x18,0x01,0x41,0x0c,0x0c,0xb5,0x47,0x01,0x41,0x18,0x18,0x80,0x02,
+    0x80,0x00,0xb5,0x47,0x02,0x40,0x0c,0x80,0x3e,0x01,0x41,0x30,0x30,0xb5,0x47,0x01,
+    0x41,0x06,0x0c,0x02,0x42,0x30,0x00,0x60,0xb5,0x47,0x02,0x40,0x03,0x82,0x40,0x41,
+    0x60,0xc0,0xb5,0x47,0x01,0x06,0xb6,0x47,0x02,0x07,0xb5,0x47,0x01,0x07,0xb5,0x47,
+    0x02,0x07,0xb5,0x47,0x01,0x07,0xb5,0x47,0x02,0x07,0xb5,0x47,0x0b,0x07,0xb5,0x47,
+    0x01,0x10,0x45,0x02,0x04,0x08,0x10,0x20,0x40,0x97,0x07,0x0e,0x02,0x85,0x47,0x86,
+    0x07,0x05,0x97,0x07,0x8c,0x2f,0x01,0x82,0x06,0x42,0x30,0x00,0x60,0x86,0x07,0x04,
+    0x98,0x07,0x8c,0x2f,0x02,0x43,0x0c,0x00,0x18,0x18,0x01,0x41,0x30,0x30,0x87,0x07,
+    0x04,0x98,0x07,0x8b,0x2f,0x01,0x80,0x05,0x40,0x18,0x83,0x00,0x84,0x07,0x05,0x97,
+    0x07,0x8c,0x2f,0x02,0x40,0x30,0x01,0x80,0x1a,0x41,0x0c,0x0c,0x88,0x07,0x03,0x99,
+    0x07,0x8a,0x2f,0x01,0x41,0x60,0x30,0x80,0x09,0x42,0x0c,0x00,0x06,0x86,0x07,0x04,
+    0x98,0x07,0x8c,0x2f,0x02,0x40,0xc0,0x82,0x18,0x41,0x06,0x03,0x86,0x07,0x05,0x97,
+    0x07,0x8c,0x2f,0x01,0x47,0x80,0xc0,0x60,0x20,0x00,0x02,0x03,0x01,0x86,0x07,0x40,
+    0x80,0x03,0x40,0x01,0x97,0x07,0x8c,0x2f,0x02,0x00,0x45,0x80,0xc0,0x40,0x04,0x05,
+    0x01,0x00,0x87,0x07,0x40,0x80,0x81,0x26,0x98,0x07,0x8b,0x2f,0x01,0x01,0x43,0x80,
+    0xb0,0x33,0x03,0x00,0x89,0x07,0x40,0x80,0x81,0x26,0x98,0x07,0x8a,0x2f,0x02,0x02,
+    0x41,0xdf,0xdf,0x00,0x8a,0x07,0x41,0x81,0x81,0x9b,0x07,0x8a,0x2f,0x01,0x01,0x43,
+    0x03,0x13,0x90,0x80,0x89,0x07,0x42,0x01,0x01,0x80,0x9a,0x07,0x8b,0x2f,0x02,0x00,
+    0x45,0x01,0x05,0x04,0x60,0xe0,0x80,0x88,0x07,0x40,0x01,0x01,0x40,0x80,0x99,0x07,
+    0x8b,0x2f,0x01,0x42,0x01,0x03,0x02,0x01,0x42,0x40,0xc0,0x80,0x86,0x07,0x80,0x26,
+    0x81,0x28,0x96,0x07,0x8c,0x2f,0x02,0x41,0x03,0x06,0x03,0x41,0x60,0xc0,0x86,0x07,
+    0x05,0x97,0x07,0x8c,0x2f,0x01,0x42,0x06,0x00,0x0c,0x01,0x42,0x30,0x30,0x60,0x87,
+    0x07,0x04,0x98,0x07,0x8b,0x2f,0x02,0x40,0x0c,0x80,0x06,0x40,0x18,0x80,0x09,0x86,
+    0x07,0x03,0x99,0x07,0x8c,0x2f,0x02,0x40,0x18,0x81,0x00,0x00,0x80,0x03,0x85,0x07,
+    0x05,0x97,0x07,0x8c,0x2f,0x01,0x41,0x30,0x30,0x82,0x1c,0x40,0x0c,0x86,0x07,0x04,
+    0x98,0x07,0x8c,0x2f,0x02,0x40,0x60,0x00,0x81,0x19,0x41,0x0c,0x06,0x87,0x07,0x04,
+    0x98,0x07,0x8b,0x2f,0x01,0x41,0xc0,0x60,0x82,0x06,0x40,0x03,0x86,0x07,0x05,0x97,
+    0x07,0x8c,0x2f,0x02,0x42,0x80,0xc0,0x40,0x01,0x42,0x02,0x03,0x01,0x86,0x07,0x40,
+    0x80,0x03,0x40,0x01,0x97,0x07,0x8c,0x2f,0x01,0x00,0x45,0x80,0xa0,0x20,0x06,0x07,
+    0x01,0x00,0x87,0x07,0x40,0x80,0x81,0x26,0x98,0x07,0x8b,0x2f,0x02,0x01,0x42,0xc0,
+    0xc8,0x09,0x81,0x06,0x86,0x07,0x42,0x80,0x80,0x01,0x9a,0x07,0x8b,0x2f,0x01,0x02,
+    0x41,0xfb,0xfb,0x00,0x8a,0x07,0x41,0x81,0x81,0x9b,0x07,0x8a,0x2f,0x02,0x01,0x43,
+    0x01,0x0d,0xcc,0xc0,0x8a,0x07,0x42,0x01,0x80,0x80,0x9a,0x07,0x8a,0x2f,0x01,0x00,
+    0x45,0x01,0x03,0x02,0x20,0xa0,0x80,0x88,0x07,0x40,0x01,0x01,0x40,0x80,0x99,0x07,
+    0x8b,0x2f,0x02,0x47,0x01,0x03,0x06,0x04,0x00,0x40,0xc0,0x80,0x86,0x07,0x80,0x26,
+    0x81,0x28,0x96,0x07,0x8c,0x2f,0x01,0x42,0x03,0x06,0x0c,0x02,0x41,0x60,0xc0,0x86,
+    0x07,0x45,0x04,0x08,0x08,0x10,0x20,0x20,0x97,0x07,0x8c,0x2f,0x02,0xbd,0x07,0x01,
+    0x47,0x01,0x03,0x06,0x04,0x00,0x40,0xc0,0x80,0xb5,0x07,0x02,0x00,0x45,0x01,0x03,
+    0x02,0x20,0xa0,0x80,0x00,0xb5,0x07,0x01,0x01,0x43,0x01,0x0d,0xcc,0xc0,0x00,0xb6,
+    0x07,0x02,0x02,0x41,0xfb,0xfb,0x00,0xb7,0x07,0x01,0x01,0x43,0xc0,0xc8,0x09,0x01,
+    0xb7,0x07,0x02,0x00,0x45,0x80,0xa0,0x20,0x06,0x07,0x01,0xb6,0x07,0x01,0x42,0x80,
+    0xc0,0x40,0x01,0x42,0x02,0x03,0x01,0xb5,0x07,0x02,0x41,0xc0,0x60,0x02,0x42,0x0c,
+    0x06,0x03,0xb5,0x07,0x02,0x42,0x60,0x00,0x30,0x82,0x08,0xb5,0x07,0x01,0x40,0x30,
+    0x80,0x06,0x43,0x18,0x18,0x00,0x0c,0xb5,0x07,0x02,0x40,0x18,0x81,0x00,0x80,0x09,
+    0xb5,0x07,0x01,0x41,0x0c,0x0c,0x80,0x47,0x01,0x40,0x30,0xb5,0x07,0x02,0x40,0x06,
+    0x00,0x80,0x08,0x42,0x30,0x30,0x60,0xb5,0x07,0x01,0x41,0x03,0x06,0x03,0x41,0x60,
+    0xc0,0xb5,0x07,0x02,0x40,0x01,0x3e,0x01,0x00,0x40,0x02,0x05,0xb5,0x47,0x02,0x01,
+    0x40,0x04,0xba,0x47,0x01,0x02,0x40,0x08,0xb9,0x47,0x02,0x03,0x40,0x10,0xb8,0x47,
+    0x01,0x04,0x40,0x20,0xb7,0x47,0x02,0x05,0x40,0x40,0xb6,0x47,0x01,0x06,0x40,0x80,
+    0xb5,0x47,0x02,0xbd,0x47,0x01,0x00,0xbc,0x47,0x02,0x01,0xbb,0x47,0x01,0x02,0xba,
+    0x47,0x02,0x03,0xb9,0x47,0x02,0x04,0xb8,0x47,0x03,0x35,0x41,0xc0,0xc0,0x05,0x41,
+    0xc0,0x40,0x03,0x2c,0x42,0xe0,0xa0,0xe0,0x04,0x42,0xa0,0xc0,0x60,0x04,0x42,0xe0,
+    0x60,0x20,0x03,0x23,0x43,0xf0,0x90,0x90,0xf0,0x03,0x43,0x90,0xe0,0xa0,0x70,0x03,
+    0x43,0x90,0xa0,0x00,0x30,0x03,0x43,0xf0,0x70,0x30,0x10,0x03,0x1a,0x44,0xf8,0x88,
+    0x88,0x88,0xf8,0x02,0x40,0x88,0x80,0x3f,0x40,0x78,0x02,0x41,0x88,0x90,0x01,0x40,
+    0x18,0x88,0x07,0x44,0xf8,0x78,0x18,0x18,0x08,0x03,0x11,0x41,0xfc,0x84,0x80,0x00,
+    0x40,0xfc,0x01,0x40,0x84,0x81,0x3f,0x40,0x7c,0x01,0x41,0x84,0x88,0x02,0x40,0x0c,
+    0x8f,0x07,0x45,0xfc,0x7c,0x0c,0x0c,0x0c,0x04,0x03,0x08,0x41,0xfe,0x82,0x81,0x00,
+    0x42,0xfe,0x00,0x82,0x82,0x3f,0x43,0x7e,0x00,0x82,0x84,0x03,0x40,0x06,0x96,0x07,
+    0x42,0xfe,0x7e,0x06,0x80,0x00,0x40,0x02,0x03,0x41,0xff,0x81,0x82,0x00,0x41,0xff,
+    0x81,0x83,0x3f,0x42,0x7f,0x81,0x82,0x04,0x40,0x03,0x9d,0x07,0x42,0xff,0x7f,0x03,
+    0x81,0x00,0x40,0x01,0x03,0x41,0x80,0xc0,0x81,0x00,0x42,0xfe,0xff,0xc0,0x04,0x41,
+    0x41,0x81,0x9d,0x07,0x41,0xfe,0x41,0x81,0x00,0x41,0x7f,0x81,0x85,0x77,0x03,0x41,
+    0x40,0x60,0x80,0x00,0x43,0x7e,0x7f,0x00,0x60,0x03,0x41,0x21,0x41,0x96,0x07,0x41,
+    0x7e,0x21,0x80,0x00,0x43,0x3f,0x41,0x00,0x7f,0x83,0x3f,0x08,0x03,0x45,0x20,0x30,
+    0x30,0x30,0x3e,0x3f,0x01,0x40,0x30,0x02,0x41,0x11,0x21,0x8f,0x07,0x44,0x3e,0x11,
+    0x11,0x11,0x1f,0x80,0x07,0x40,0x3f,0x82,0x3f,0x11,0x03,0x44,0x10,0x18,0x18,0x1e,
+    0x1f,0x02,0x40,0x18,0x01,0x41,0x09,0x11,0x88,0x07,0x43,0x1e,0x09,0x09,0x0f,0x81,
+    0x07,0x40,0x1f,0x81,0x3f,0x1a,0x03,0x43,0x08,0x0c,0x0e,0x0f,0x03,0x43,0x0c,0x00,
+    0x05,0x09,0x03,0x42,0x0e,0x05,0x07,0x82,0x07,0x40,0x0f,0x80,0x3f,0x23,0x06,0x42,
+    0x04,0x06,0x07,0x04,0x42,0x06,0x03,0x05,0x04,0x42,0x07,0x05,0x07,0x2c,0x03,0xbd,
+    0x3f,0x03,0x43,0x08,0x0c,0x0e,0x0f,0x03,0x43,0x0c,0x00,0x05,0x09,0x03,0x42,0x0e,
+    0x05,0x07,0x82,0x07,0x43,0x0f,0x09,0x09,0x0f,0x23,0x03,0x44,0x10,0x18,0x18,0x1e,
+    0x1f,0x02,0x40,0x18,0x01,0x41,0x09,0x11,0x88,0x07,0x40,0x1e,0x80,0x3f,0x81,0x07,
+    0x44,0x1f,0x11,0x11,0x11,0x1f,0x1a,0x03,0x45,0x20,0x30,0x30,0x30,0x3e,0x3f,0x01,
+    0x40,0x30,0x02,0x41,0x11,0x21,0x8f,0x07,0x40,0x3e,0x81,0x3f,0x80,0x07,0x41,0x3f,
+    0x21,0x80,0x00,0x40,0x3f,0x11,0x03,0x41,0x40,0x60,0x80,0x00,0x43,0x7e,0x7f,0x00,
+    0x60,0x03,0x41,0x21,0x41,0x96,0x07,0x40,0x7e,0x82,0x3f,0x43,0x41,0x00,0x7f,0x41,
+    0x81,0x00,0x40,0x7f,0x08,0x04,0x41,0x80,0xc0,0x81,0x00,0x42,0xfe,0xff,0xc0,0x04,
+    0x41,0x41,0x81,0x9d,0x07,0x40,0xfe,0x83,0x3f,0x42,0x81,0xff,0x81,0x82,0x00,0x40,
+    0xff,0x03,0x41,0x01,0x03,0x81,0x00,0x42,0x7f,0xff,0x03,0x04,0x41,0x82,0x81,0x9d,
+    0x07,0x41,0x7f,0x82,0x81,0x00,0x40,0xfe,0x86,0x3f,0x03,0x41,0x02,0x06,0x80,0x00,
+    0x43,0x7e,0xfe,0x00,0x06,0x03,0x41,0x84,0x82,0x96,0x07,0x41,0x7e,0x84,0x80,0x00,
+    0x43,0xfc,0x82,0x00,0xfe,0x83,0x3f,0x08,0x03,0x45,0x04,0x0c,0x0c,0x0c,0x7c,0xfc,
+    0x01,0x40,0x0c,0x02,0x41,0x88,0x84,0x8f,0x07,0x44,0x7c,0x88,0x88,0x88,0xf8,0x80,
+    0x07,0x40,0xfc,0x82,0x3f,0x11,0x03,0x44,0x08,0x18,0x18,0x78,0xf8,0x02,0x40,0x18,
+    0x01,0x41,0x90,0x88,0x88,0x07,0x43,0x78,0x90,0x90,0xf0,0x81,0x07,0x40,0xf8,0x81,
+    0x3f,0x1a,0x03,0x43,0x10,0x30,0x70,0xf0,0x03,0x43,0x30,0x00,0xa0,0x90,0x03,0x42,
+    0x70,0xa0,0xe0,0x82,0x07,0x40,0xf0,0x80,0x3f,0x23,0x06,0x42,0x20,0x60,0xe0,0x04,
+    0x42,0x60,0xc0,0xa0,0x04,0x42,0xe0,0xa0,0xe0,0x2c,0x03,0x42,0x20,0x20,0xe0,0x8a,
+    0x07,0x41,0xe0,0xe0,0xab,0x3f,0x03,0x43,0x10,0x10,0x10,0xf0,0x91,0x07,0x40,0xf0,
+    0x80,0x00,0x23,0x03,0x40,0x08,0x80,0x00,0x40,0xf8,0x98,0x07,0x40,0xf8,0x81,0x00,
+    0x1a,0x03,0x40,0x04,0x81,0x00,0x40,0xfc,0x9f,0x07,0x40,0xfc,0x82,0x00,0x11,0x03,
+    0x40,0x02,0x82,0x00,0x40,0xfe,0xa6,0x07,0x40,0xfe,0x83,0x00,0x08,0x03,0x40,0x01,
+    0x83,0x00,0x40,0xff,0xad,0x07,0x85,0x00,0x03,0x86,0x00,0x40,0x80,0x83,0x00,0xad,
+    0x07,0x03,0x08,0x40,0x7f,0x83,0x00,0x00,0x41,0x7f,0x40,0x82,0x00,0xa5,0x07,0x03,
+    0x11,0x40,0x3f,0x82,0x00,0x01,0x41,0x3f,0x20,0x81,0x00,0x9d,0x07,0x03,0x1a,0x40,
+    0x1f,0x81,0x00,0x02,0x41,0x1f,0x10,0x80,0x00,0x95,0x07,0x03,0x23,0x40,0x0f,0x80,
+    0x00,0x03,0x43,0x0f,0x08,0x08,0x08,0x8d,0x07,0x03,0x2c,0x42,0x07,0x07,0x07,0x04,
+    0x42,0x07,0x04,0x04,0x85,0x07,0x00,0x0a,0x2c,0x42,0x07,0x07,0x07,0x8d,0x07,0x09,
+    0x23,0x40,0x0f,0x80,0x00,0x03,0x43,0x0f,0x08,0x08,0x08,0x8d,0x07,0x09,0x1a,0x41,
+    0x1b,0x1b,0x81,0x02,0x01,0x44,0x1b,0x14,0x0f,0x14,0x14,0x88,0x47,0x85,0x0f,0x82,
+    0x07,0x09,0x11,0x41,0x33,0x33,0x84,0x03,0x44,0x28,0x1b,0x00,0x28,0x28,0x88,0x47,
+    0x04,0x87,0x17,0x83,0x07,0x09,0x08,0x41,0x63,0x63,0x83,0x04,0x41,0x63,0x50,0x80,
+    0x3b,0x41,0x50,0x50,0x87,0x47,0x0d,0x86,0x1f,0x84,0x07,0x0c,0x41,0xc3,0xc3,0x03,
+    0x43,0xc3,0xc3,0xc3,0xa0,0x81,0x3f,0x41,0xa0,0xa0,0x86,0x47,0x16,0x85,0x27,0x85,
+    0x07,0x03,0x41,0xa3,0xa3,0x03,0x41,0xa3,0xa3,0x80,0x39,0x82,0x0f,0x41,0x03,0x03,
+    0x03,0x83,0x05,0x0b,0x41,0xc0,0xc0,0x83,0x05,0x41,0x05,0x05,0x03,0x43,0x05,0x05,
+    0xc5,0xc5,0x03,0x41,0xc5,0xc5,0x04,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,
+    0x03,0x83,0x05,0x03,0x85,0x47,0x85,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,
+    0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x8d,
+    0x37,0x8d,0x0f,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x03,0x8d,0x07,0x85,
+    0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,
+    0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,
+    0x50,0x50,0x03,0x41,0xc5,0xc5,0x03,0x43,0xc5,0xc5,0x05,0x05,0x03,0x41,0x05,0x05,
+    0x85,0x37,0x0f,0x85,0x47,0x41,0xa0,0xa0,0x03,0x43,0xa0,0xa0,0xa3,0xa3,0x03,0x41,
+    0xa3,0xa3,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,
+    0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x89,0x6f,0x85,
+    0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,
+    0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x14,0x14,0x03,
+    0x41,0x14,0x14,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,
+    0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,
+    0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0xc5,0xc5,0x03,
+    0x43,0xc5,0xc5,0x05,0x05,0x03,0x41,0x05,0x05,0x85,0x37,0x0f,0x85,0x47,0x41,0xa0,
+    0xa0,0x03,0x43,0xa0,0xa0,0xa3,0xa3,0x03,0x41,0xa3,0xa3,0x03,0x85,0x07,0x85,0x17,
+    0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,0x03,0x41,0x50,0x50,0x03,0x43,0x50,
+    0x50,0x53,0x53,0x03,0x83,0x05,0x89,0x6f,0x85,0x37,0x07,0x41,0xca,0xca,0x83,0x05,
+    0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,
+    0x07,0x8d,0x37,0x8d,0x0f,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x03,0x8d,
+    0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,
+    0xca,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,
+    0x03,0x41,0x50,0x50,0x03,0x41,0xc5,0xc5,0x03,0x43,0xc5,0xc5,0x05,0x05,0x03,0x41,
+    0x05,0x05,0x85,0x37,0x0f,0x85,0x47,0x41,0xa0,0xa0,0x03,0x43,0xa0,0xa0,0xa3,0xa3,
+    0x03,0x41,0xa3,0xa3,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,
+    0x85,0x77,0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x89,
+    0x6f,0x85,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,
+    0x03,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x14,
+    0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x04,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,
+    0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x03,0x8d,0x37,
+    0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0xc5,
+    0xc5,0x03,0x43,0xc5,0xc5,0x05,0x05,0x03,0x41,0x05,0x05,0x85,0x37,0x0f,0x85,0x47,
+    0x41,0xa0,0xa0,0x03,0x43,0xa0,0xa0,0xa3,0xa3,0x03,0x41,0xa3,0xa3,0x03,0x85,0x07,
+    0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,0x03,0x41,0x50,0x50,0x03,
+    0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x89,0x6f,0x85,0x37,0x07,0x41,0xca,0xca,
+    0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0x28,0x28,0x03,0x41,0x28,
+    0x28,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,
+    0x03,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,
+    0x0a,0xca,0xca,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,
+    0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0xc5,0xc5,0x03,0x43,0xc5,0xc5,0x05,0x05,
+    0x03,0x41,0x05,0x05,0x85,0x37,0x0f,0x85,0x47,0x41,0xa0,0xa0,0x03,0x43,0xa0,0xa0,
+    0xa3,0xa3,0x03,0x41,0xa3,0xa3,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,
+    0x85,0x67,0x85,0x77,0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,
+    0x05,0x89,0x6f,0x85,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,
+    0x0a,0x0a,0x03,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x8d,0x37,0x8d,0x0f,
+    0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,
+    0x8d,0x6f,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x03,
+    0x8d,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,
+    0xbd,0x3f,0x03,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x8d,0x37,0x8d,0x0f,
+    0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,
+    0x8d,0x6f,0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x03,
+    0x8d,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,
+    0x41,0xa3,0xa3,0x03,0x43,0xa3,0xa3,0xa0,0xa0,0x03,0x41,0xa0,0xa0,0x85,0x37,0x0f,
+    0x85,0x47,0x41,0x05,0x05,0x03,0x43,0x05,0x05,0xc5,0xc5,0x03,0x41,0xc5,0xc5,0x03,
+    0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,0x04,0x41,0x0a,
+    0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x89,0x6f,0x85,0x37,0x07,0x41,
+    0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0x14,0x14,0x03,
+    0x41,0x14,0x14,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x28,0x28,0x03,0x41,0x28,0x28,
+    0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x50,0x50,0x03,
+    0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0xca,0xca,0x83,
+    0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0xa3,0xa3,0x03,0x43,0xa3,0xa3,
+    0xa0,0xa0,0x03,0x41,0xa0,0xa0,0x85,0x37,0x0f,0x85,0x47,0x41,0x05,0x05,0x03,0x43,
+    0x05,0x05,0xc5,0xc5,0x03,0x41,0xc5,0xc5,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,
+    0x85,0x57,0x85,0x67,0x85,0x77,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,
+    0x03,0x83,0x05,0x89,0x6f,0x85,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,
+    0x03,0x41,0x50,0x50,0x03,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x8d,0x37,
+    0x8d,0x0f,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,
+    0x95,0x47,0x8d,0x6f,0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,
+    0x05,0x03,0x8d,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,
+    0x0a,0x03,0x41,0xa3,0xa3,0x03,0x43,0xa3,0xa3,0xa0,0xa0,0x03,0x41,0xa0,0xa0,0x85,
+    0x37,0x0f,0x85,0x47,0x41,0x05,0x05,0x03,0x43,0x05,0x05,0xc5,0xc5,0x03,0x41,0xc5,
+    0xc5,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,0x03,
+    0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x89,0x6f,0x85,0x37,
+    0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0x14,
+    0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x28,0x28,0x03,0x41,
+    0x28,0x28,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x50,
+    0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0xca,
+    0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0xa3,0xa3,0x03,0x43,
+    0xa3,0xa3,0xa0,0xa0,0x03,0x41,0xa0,0xa0,0x85,0x37,0x0f,0x85,0x47,0x41,0x05,0x05,
+    0x03,0x43,0x05,0x05,0xc5,0xc5,0x03,0x41,0xc5,0xc5,0x03,0x85,0x07,0x85,0x17,0x85,
+    0x27,0x0f,0x85,0x57,0x85,0x67,0x85,0x77,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,
+    0xca,0xca,0x03,0x83,0x05,0x89,0x6f,0x85,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,
+    0x50,0x50,0x03,0x41,0x50,0x50,0x03,0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,
+    0x8d,0x37,0x8d,0x0f,0x41,0x28,0x28,0x03,0x41,0x28,0x28,0x85,0x07,0x04,0x8d,0x07,
+    0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,
+    0x03,0x83,0x05,0x03,0x8d,0x37,0x07,0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,
+    0x41,0x0a,0x0a,0x03,0x41,0xa3,0xa3,0x03,0x43,0xa3,0xa3,0xa0,0xa0,0x03,0x41,0xa0,
+    0xa0,0x85,0x37,0x0f,0x85,0x47,0x41,0x05,0x05,0x03,0x43,0x05,0x05,0xc5,0xc5,0x03,
+    0x41,0xc5,0xc5,0x03,0x85,0x07,0x85,0x17,0x85,0x27,0x0f,0x85,0x57,0x85,0x67,0x85,
+    0x77,0x03,0x41,0x0a,0x0a,0x03,0x43,0x0a,0x0a,0xca,0xca,0x03,0x83,0x05,0x89,0x6f,
+    0x85,0x37,0x07,0x41,0x53,0x53,0x83,0x05,0x41,0x50,0x50,0x03,0x41,0x50,0x50,0x03,
+    0x41,0x14,0x14,0x03,0x41,0x14,0x14,0x85,0x07,0x8d,0x37,0x8d,0x0f,0x41,0x28,0x28,
+    0x03,0x41,0x28,0x28,0x85,0x07,0x03,0x8d,0x07,0x85,0x27,0x95,0x47,0x8d,0x6f,0x03,
+    0x41,0x50,0x50,0x03,0x43,0x50,0x50,0x53,0x53,0x03,0x83,0x05,0x03,0x8d,0x37,0x07,
+    0x41,0xca,0xca,0x83,0x05,0x41,0x0a,0x0a,0x03,0x41,0x0a,0x0a,0x03,0x41,0xa3,0xa3,
+    0x03,0x43,0xa3,0xa3,0xa0,0xa0,0x03,0x41,0xa0,0xa0,0x85,0x37,0x0f,0x85,0x47,0x41,
+    0x05,0x05,0x03,0x43,0x05,0x05,0xc5,0xc5,0x03,0x41,0xc5,0xc5,0x03,0x41,0xa3,0xa0,
+    0x80,0x2a,0x41,0xc0,0x05,0x86,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,
+    0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x28,0x28,0x03,0xc0,0x03,
+    0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x14,0x14,0x80,0x06,0x42,0x03,
+    0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,
+    0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,
+    0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,
+    0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,
+    0x1f,0x8d,0x2f,0x03,0x47,0x28,0x28,0x03,0xc0,0x03,0xc0,0x14,0x14,0x85,0x07,0x1f,
+    0x8d,0x2f,0x03,0x41,0x14,0x14,0x80,0x06,0x42,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,
+    0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,
+    0x04,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,
+    0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,
+    0x50,0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x28,
+    0x28,0x03,0xc0,0x03,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x14,0x14,
+    0x80,0x06,0x42,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,
+    0xc0,0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,
+    0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,
+    0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,
+    0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x28,0x28,0x03,0xc0,0x03,0xc0,0x14,
+    0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x14,0x14,0x80,0x06,0x42,0x03,0x28,0x28,
+    0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,
+    0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,
+    0x1f,0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,
+    0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,
+    0x2f,0x03,0x47,0x28,0x28,0x03,0xc0,0x03,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,
+    0x03,0x41,0x14,0x14,0x80,0x06,0x42,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,
+    0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,
+    0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xa3,
+    0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x04,0x47,0x50,0x53,
+    0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x28,0x28,0x03,
+    0xc0,0x03,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x14,0x14,0x80,0x06,
+    0x42,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,
+    0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0xbd,0x3f,0x03,0x47,0x14,0x14,0xc0,
+    0x03,0xc0,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x28,0x28,0x80,0x06,
+    0x42,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,
+    0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,
+    0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,
+    0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,
+    0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x14,0x14,0xc0,0x03,0xc0,0x03,0x28,0x28,0x85,
+    0x07,0x1f,0x8d,0x2f,0x03,0x41,0x28,0x28,0x80,0x06,0x42,0xc0,0x14,0x14,0x85,0x07,
+    0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,
+    0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,
+    0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,
+    0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,
+    0x47,0x14,0x14,0xc0,0x03,0xc0,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,
+    0x28,0x28,0x80,0x06,0x42,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,
+    0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x04,0x42,0xa3,0xa0,
+    0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,
+    0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,
+    0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x14,0x14,0xc0,0x03,0xc0,
+    0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x28,0x28,0x80,0x06,0x42,0xc0,
+    0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,0xca,
+    0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,
+    0x85,0x07,0x1f,0x8d,0x2f,0x03,0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,
+    0x07,0x1f,0x8d,0x2f,0x03,0x47,0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,0x07,
+    0x1f,0x8d,0x2f,0x03,0x47,0x14,0x14,0xc0,0x03,0xc0,0x03,0x28,0x28,0x85,0x07,0x1f,
+    0x8d,0x2f,0x03,0x41,0x28,0x28,0x80,0x06,0x42,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,
+    0x2f,0x03,0x47,0x50,0x53,0x00,0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,
+    0x03,0x42,0xa3,0xa0,0x03,0x01,0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x03,
+    0x42,0xc5,0x05,0xc0,0x01,0x42,0x03,0xa0,0xa3,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,
+    0x0a,0xca,0x00,0xc0,0x03,0x00,0x53,0x50,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x14,
+    0x14,0xc0,0x03,0xc0,0x03,0x28,0x28,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x41,0x28,0x28,
+    0x80,0x06,0x42,0xc0,0x14,0x14,0x85,0x07,0x1f,0x8d,0x2f,0x03,0x47,0x50,0x53,0x00,
+    0x03,0xc0,0x00,0xca,0x0a,0x85,0x07,0x1f,0x8d,0x2f,0x0d,0x42,0xa3,0xa0,0x03,0x01,
+    0x42,0xc0,0x05,0xc5,0x85,0x07,0x1f,0x8d,0x2f,0x09,0x41,0xc3,0xc3,0x03,0x44,0xc3,
+    0xc3,0xc3,0xa0,0x63,0x02,0x43,0xa0,0xa0,0x00,0x63,0x81,0x07,0x82,0x04,0x14,0x85,
+    0x27,0x85,0x07,0x09,0x07,0x86,0x37,0x42,0x63,0x50,0x33,0x01,0x41,0x50,0x50,0x01,
+    0x41,0x33,0x33,0x83,0x03,0x0d,0x86,0x1f,0x84,0x07,0x09,0x0f,0x87,0x37,0x45,0x33,
+    0x28,0x1b,0x00,0x28,0x28,0x02,0x41,0x1b,0x1b,0x81,0x02,0x06,0x87,0x17,0x83,0x07,
+    0x09,0x17,0x88,0x37,0x44,0x1b,0x14,0x0f,0x14,0x14,0x03,0x40,0x0f,0x80,0x00,0x88,
+    0x0f,0x82,0x07,0x09,0x1f,0x88,0x37,0x00,0x43,0x0f,0x08,0x08,0x08,0x8d,0x07,0x00,
+    0x04,0x40,0x02,0x84,0x00,0x37,0x03,0x40,0x06,0x84,0x00,0xb5,0x47,0x03,0x40,0x0c,
+    0x84,0x00,0xb5,0x47,0x03,0x40,0x18,0x84,0x00,0x95,0x47,0x9d,0x4f,0x03,0x40,0x30,
+    0x84,0x00,0x95,0x47,0x8d,0x4f,0x0f,0x03,0x40,0x60,0x84,0x00,0x95,0x47,0x85,0x00,
+    0x95,0x47,0x03,0x40,0xc0,0x84,0x00,0x95,0x47,0x85,0x00,0x95,0x47,0x03,0x40,0x80,
+    0x84,0x00,0x95,0x47,0x8d,0x4f,0x40,0x0e,0x84,0x00,0x85,0x47,0x03,0x07,0x95,0x47,
+    0x85,0x00,0x40,0x32,0x84,0x00,0x40,0x1e,0x84,0x00,0x40,0x0c,0x84,0x00,0x03,0x07,
+    0x8d,0x47,0x40,0xc2,0x8c,0x00,0x40,0x66,0x84,0x00,0x40,0x3c,0x84,0x00,0x40,0x18,
+    0x84,0x00,0x03,0x0f,0x40,0x02,0x84,0x00,0x40,0x86,0x8c,0x00,0x40,0xcc,0x84,0x00,
+    0x40,0x78,0x84,0x00,0x40,0x30,0x84,0x00,0x03,0x8d,0x37,0x40,0x06,0x84,0x00,0x40,
+    0x0c,0x8c,0x00,0x40,0x98,0x84,0x00,0x40,0xf0,0x84,0x00,0x40,0x60,0x84,0x00,0x03,
+    0x95,0x37,0x40,0x18,0x8c,0x00,0x85,0x6f,0x40,0xe0,0x84,0x00,0x40,0xc0,0x84,0x00,
+    0x03,0x40,0x04,0x84,0x00,0x8d,0x37,0x40,0x30,0x8c,0x00,0x85,0x6f,0x85,0x37,0x40,
+    0x80,0x84,0x00,0x03,0x40,0x0a,0x84,0x00,0x40,0x1a,0x84,0x00,0x8d,0x2f,0x95,0x37,
+    0x07,0x03,0x40,0x14,0x84,0x00,0x40,0x36,0x84,0x00,0x40,0x62,0x84,0x00,0x85,0x2f,
+    0x95,0x37,0x07,0x03,0x40,0x28,0x84,0x00,0x40,0x6c,0x84,0x00,0x40,0xc6,0x84,0x00,
+    0x40,0x82,0x8c,0x00,0x17,0x03,0x40,0x50,0x84,0x00,0x40,0xd8,0x84,0x00,0x40,0x8c,
+    0x84,0x00,0x40,0x06,0x8c,0x00,0x40,0x02,0x84,0x00,0x0f,0x03,0x40,0xa0,0x84,0x00,
+    0x40,0xb0,0x84,0x00,0x40,0x18,0x84,0x00,0x40,0x0c,0x8c,0x00,0x95,0x47,0x03,0x40,
+    0x40,0x84,0x00,0x40,0x60,0x84,0x00,0x40,0x30,0x84,0x00,0x40,0x18,0x8c,0x00,0x95,
+    0x47,0x04,0x40,0x80,0x84,0x00,0x40,0xc0,0x84,0x00,0x8d,0x47,0x8d,0x4f,0x40,0x0e,
+    0x84,0x00,0x85,0x47,0x03,0x07,0x95,0x47,0x85,0x00,0x40,0x32,0x84,0x00,0x40,0x1e,
+    0x84,0x00,0x40,0x0c,0x84,0x00,0x03,0x07,0x8d,0x47,0x40,0xc2,0x8c,0x00,0x40,0x66,
+    0x84,0x00,0x40,0x3c,0x84,0x00,0x40,0x18,0x84,0x00,0x03,0x0f,0x40,0x02,0x84,0x00,
+    0x40,0x86,0x8c,0x00,0x40,0xcc,0x84,0x00,0x40,0x78,0x84,0x00,0x40,0x30,0x84,0x00,
+    0x03,0x8d,0x37,0x40,0x06,0x84,0x00,0x40,0x0c,0x8c,0x00,0x40,0x98,0x84,0x00,0x40,
+    0xf0,0x84,0x00,0x40,0x60,0x84,0x00,0x03,0x95,0x37,0x40,0x18,0x8c,0x00,0x85,0x6f,
+    0x40,0xe0,0x84,0x00,0x40,0xc0,0x84,0x00,0x03,0x40,0x04,0x84,0x00,0x8d,0x37,0x40,
+    0x30,0x8c,0x00,0x85,0x6f,0x85,0x37,0x40,0x80,0x84,0x00,0x03,0x40,0x0a,0x84,0x00,
+    0x40,0x1a,0x84,0x00,0x8d,0x2f,0x95,0x37,0x07,0x03,0x40,0x14,0x84,0x00,0x40,0x36,
+    0x84,0x00,0x40,0x62,0x84,0x00,0x85,0x2f,0x95,0x37,0x07,0x03,0x40,0x28,0x84,0x00,
+    0x40,0x6c,0x84,0x00,0x40,0xc6,0x84,0x00,0x40,0x82,0x8c,0x00,0x17,0x03,0x40,0x50,
+    0x84,0x00,0x40,0xd8,0x84,0x00,0x40,0x8c,0x84,0x00,0x40,0x06,0x8c,0x00,0x40,0x02,
+    0x84,0x00,0x0f,0x03,0x40,0xa0,0x84,0x00,0x40,0xb0,0x84,0x00,0x40,0x18,0x84,0x00,
+    0x40,0x0c,0x8c,0x00,0x95,0x47,0x03,0x40,0x40,0x84,0x00,0x40,0x60,0x84,0x00,0x40,
+    0x30,0x84,0x00,0x40,0x18,0x8c,0x00,0x95,0x47,0x03,0x40,0x80,0x84,0x00,0x40,0xc0,
+    0x84,0x00,0x8d,0x47,0x8d,0x4f,0x40,0x0e,0x84,0x00,0x85,0x47,0x03,0x07,0x95,0x47,
+    0x85,0x00,0x40,0x32,0x84,0x00,0x40,0x1e,0x84,0x00,0x40,0x0c,0x84,0x00,0x03,0x07,
+    0x8d,0x47,0x40,0xc2,0x8c,0x00,0x40,0x66,0x84,0x00,0x40,0x3c,0x84,0x00,0x40,0x18,
+    0x84,0x00,0x03,0x0f,0x40,0x02,0x84,0x00,0x40,0x86,0x8c,0x00,0x40,0xcc,0x84,0x00,
+    0x40,0x78,0x84,0x00,0x40,0x30,0x84,0x00,0x03,0x8d,0x37,0x40,0x06,0x84,0x00,0x40,
+    0x0c,0x8c,0x00,0x40,0x98,0x84,0x00,0x40,0xf0,0x84,0x00,0x40,0x60,0x84,0x00,0x03,
+    0x95,0x37,0x40,0x18,0x8c,0x00,0x85,0x6f,0x40,0xe0,0x84,0x00,0x40,0xc0,0x84,0x00,
+    0x03,0x40,0x04,0x84,0x00,0x8d,0x37,0x40,0x30,0x8c,0x00,0x85,0x6f,0x85,0x37,0x40,
+    0x80,0x84,0x00,0x04,0x40,0x0a,0x84,0x00,0x40,0x1a,0x84,0x00,0x8d,0x2f,0x95,0x37,
+    0x07,0x03,0x40,0x14,0x84,0x00,0x40,0x36,0x84,0x00,0x40,0x62,0x84,0x00,0x85,0x2f,
+    0x95,0x37,0x07,0x03,0x40,0x28,0x84,0x00,0x40,0x6c,0x84,0x00,0x40,0xc6,0x84,0x00,
+    0x40,0x82,0x8c,0x00,0x17,0x03,0x40,0x50,0x84,0x00,0x40,0xd8,0x84,0x00,0x40,0x8c,
+    0x84,0x00,0x40,0x06,0x8c,0x00,0x40,0x02,0x84,0x00,0x0f,0x03,0x40,0xa0,0x84,0x00,
+    0x40,0xb0,0x84,0x00,0x40,0x18,0x84,0x00,0x40,0x0c,0x8c,0x00,0x95,0x47,0x03,0x40,
+    0x40,0x84,0x00,0x40,0x60,0x84,0x00,0x40,0x30,0x84,0x00,0x40,0x18,0x8c,0x00,0x95,
+    0x47,0x03,0x40,0x80,0x84,0x00,0x40,0xc0,0x84,0x00,0x8d,0x47,0x8d,0x4f,0x40,0x0e,
+    0x84,0x00,0x85,0x47,0x03,0x07,0x95,0x47,0x85,0x00,0x40,0x32,0x84,0x00,0x40,0x1e,
+    0x84,0x00,0x40,0x0c,0x84,0x00,0x03,0x07,0x8d,0x47,0x40,0xc2,0x8c,0x00,0x40,0x66,
+    0x84,0x00,0x40,0x3c,0x84,0x00,0x40,0x18,0x84,0x00,0x03,0x0f,0x40,0x02,0x84,0x00,
+    0x40,0x86,0x8c,0x00,0x40,0xcc,0x84,0x00,0x40,0x78,0x84,0x00,0x40,0x30,0x84,0x00,
+    0x03,0x8d,0x37,0x40,0x06,0x84,0x00,0x40,0x0c,0x8c,0x00,0x40,0x98,0x84,0x00,0x40,
+    0xf0,0x84,0x00,0x40,0x60,0x84,0x00,0x03,0x95,0x37,0x40,0x18,0x8c,0x00,0x85,0x6f,
+    0x40,0xe0,0x84,0x00,0x40,0xc0,0x84,0x00,0x03,0x40,0x04,0x84,0x00,0x8d,0x37,0x40,
+    0x30,0x8c,0x00,0x85,0x6f,0x85,0x37,0x40,0x80,0x84,0x00,0x03,0x40,0x0a,0x84,0x00,
+    0x40,0x1a,0x84,0x00,0x8d,0x2f,0x95,0x37,0x07,0x03,0x40,0x14,0x84,0x00,0x40,0x36,
+    0x84,0x00,0x40,0x62,0x84,0x00,0x85,0x2f,0x95,0x37,0x07,0x03,0x40,0x28,0x84,0x00,
+    0x40,0x6c,0x84,0x00,0x40,0xc6,0x84,0x00,0x40,0x82,0x8c,0x00,0x17,0x03,0x40,0x50,
+    0x84,0x00,0x40,0xd8,0x84,0x00,0x40,0x8c,0x84,0x00,0x40,0x06,0x8c,0x00,0x40,0x02,
+    0x84,0x00,0x0f,0x03,0x40,0xa0,0x84,0x00,0x40,0xb0,0x84,0x00,0x40,0x18,0x84,0x00,
+    0x40,0x0c,0x8c,0x00,0x95,0x47,0x03,0x40,0x40,0x84,0x00,0x40,0x60,0x84,0x00,0x40,
+    0x30,0x84,0x00,0x40,0x18,0x8c,0x00,0x95,0x47,0x03,0x40,0x80,0x84,0x00,0x40,0xc0,
+    0x84,0x00,0x8d,0x47,0x8d,0x4f,0x40,0x0e,0x84,0x00,0x85,0x47,0x04,0x07,0x95,0x47,
+    0x85,0x00,0x40,0x32,0x84,0x00,0x40,0x1e,0x84,0x00,0x40,0x0c,0x84,0x00,0x03,0x07,
+    0x8d,0x47,0x40,0xc2,0x8c,0x00,0x40,0x66,0x84,0x00,0x40,0x3c,0x84,0x00,0x40,0x18,
+    0x84,0x00,0x03,0x0f,0x40,0x02,0x84,0x00,0x40,0x86,0x8c,0x00,0x40,0xcc,0x84,0x00,
+    0x40,0x78,0x84,0x00,0x40,0x30,0x84,0x00,0x03,0x8d,0x37,0x40,0x06,0x84,0x00,0x40,
+    0x0c,0x8c,0x00,0x40,0x98,0x84,0x00,0x40,0xf0,0x84,0x00,0x40,0x60,0x84,0x00,0x03,
+    0x95,0x37,0x40,0x18,0x8c,0x00,0x85,0x6f,0x40,0xe0,0x84,0x00,0x40,0xc0,0x84,0x00,
+    0x03,0x41,0x04,0x04,0x83,0x37,0x41,0x0e,0x0e,0x8b,0x37,0x40,0x30,0x8c,0x00,0x85,
+    0x6f,0x85,0x37,0x40,0x80,0x84,0x00,0x03,0x41,0x0a,0x0a,0x83,0x37,0x41,0x1c,0x1c,
+    0x83,0x37,0x41,0x32,0x32,0x8b,0x2f,0x95,0x37,0x07,0x03,0x41,0x14,0x14,0x83,0x37,
+    0x41,0x3a,0x3a,0x83,0x37,0x41,0x64,0x64,0x83,0x2f,0x41,0xc2,0xc2,0x83,0x2f,0x95,
+    0x37,0x07,0x03,0x41,0x28,0x28,0x83,0x37,0x41,0x74,0x74,0x83,0x37,0x41,0xca,0xca,
+    0x83,0x2f,0x41,0x84,0x84,0x83,0x2f,0x41,0x82,0x82,0x83,0x07,0x17,0x03,0x41,0x50,
+    0x50,0x83,0x37,0x41,0xe8,0xe8,0x83,0x37,0x41,0x94,0x94,0x83,0x2f,0x41,0x0a,0x0a,
+    0x05,0x41,0x04,0x04,0x05,0x41,0x02,0x02,0x15,0x03,0x41,0xa0,0xa0,0x83,0x37,0x41,
+    0xd0,0xd0,0x83,0x37,0x41,0x28,0x28,0x05,0x41,0x14,0x14,0x05,0x9d,0x47,0x03,0x41,
+    0x40,0x40,0x83,0x37,0x41,0xa0,0xa0,0x05,0x41,0x50,0x50,0x05,0xa5,0x47,0x03,0x41,
+    0x80,0x80,0x85,0x47,0x05,0x9e,0x47,0x40,0x08,0x83,0x38,0x41,0x06,0x04,0x83,0x07,
+    0x03,0x01,0xac,0x47,0x40,0x12,0x83,0x38,0x41,0x0c,0x0a,0x83,0x07,0x03,0x02,0xab,
+    0x47,0x40,0x24,0x83,0x38,0x41,0x18,0x14,0x83,0x07,0x03,0x03,0xaa,0x47,0x40,0x48,
+    0x83,0x38,0x41,0x30,0x28,0x83,0x07,0x03,0x04,0xa9,0x47,0x40,0x90,0x83,0x38,0x41,
+    0x60,0x50,0x83,0x07,0x03,0x05,0xa8,0x47,0x40,0x20,0x83,0x38,0x41,0xc0,0xa0,0x83,
+    0x07,0x03,0x2d,0x43,0x02,0x02,0x80,0x40,0x81,0x38,0x41,0x08,0x04,0x83,0x07,0x41,
+    0x0a,0x06,0x03,0xa5,0x37,0x05,0x41,0x04,0x04,0x00,0x82,0x38,0x41,0x12,0x0a,0x00,
+    0x83,0x40,0x40,0x0c,0x04,0xa6,0x37,0x04,0x41,0x0a,0x0a,0x00,0x82,0x38,0x41,0x24,
+    0x14,0x00,0x83,0x40,0x40,0x18,0x03,0xa7,0x37,0x03,0x40,0x14,0x80,0x37,0x81,0x38,
+    0x41,0x48,0x28,0x00,0x83,0x40,0x40,0x30,0x03,0xa8,0x37,0x02,0x40,0x28,0x81,0x37,
+    0x80,0x38,0x41,0x90,0x50,0x00,0x83,0x40,0x40,0x60,0x03,0xa9,0x37,0x01,0x41,0x50,
+    0x50,0x04,0x42,0x80,0x20,0xa0,0x00,0x83,0x40,0x40,0xc0,0x03,0x04,0x42,0x02,0x04,
+    0x06,0x04,0x41,0x02,0x08,0x9b,0x37,0x00,0x41,0xa0,0xa0,0x05,0x41,0x40,0x40,0x05,
+    0x41,0x80,0x80,0x03,0x83,0x3e,0x41,0x0a,0x0c,0x83,0x07,0x40,0x12,0xaa,0x37,0x03,
+    0x03,0x83,0x3e,0x41,0x14,0x18,0x83,0x07,0x40,0x24,0xa9,0x37,0x04,0x03,0x83,0x3e,
+    0x41,0x28,0x30,0x83,0x07,0x40,0x48,0xa8,0x37,0x05,0x03,0x83,0x3e,0x41,0x50,0x60,
+    0x83,0x07,0x40,0x90,0xa7,0x37,0x06,0x03,0x83,0x3e,0x41,0xa0,0xc0,0x83,0x07,0x40,
+    0x20,0xa6,0x37,0x07,0x03,0x40,0x06,0x82,0x3e,0x41,0x40,0x80,0x85,0x07,0x41,0x02,
+    0x02,0x05,0x85,0x07,0x1f,0x03,0x40,0x0c,0x83,0x36,0x86,0x07,0x41,0x06,0x06,0x04,
+    0x86,0x07,0x9d,0x4f,0x03,0x40,0x18,0x83,0x36,0x86,0x07,0x41,0x0c,0x0c,0x03,0x87,
+    0x07,0x9d,0x4f,0x03,0x40,0x30,0x83,0x36,0x86,0x07,0x41,0x18,0x18,0x02,0x88,0x07,
+    0x8f,0x4f,0x83,0x39,0x85,0x07,0x03,0x40,0x60,0x83,0x36,0x86,0x07,0x41,0x30,0x30,
+    0x01,0x89,0x07,0x8f,0x4f,0x83,0x39,0x85,0x07,0x03,0x40,0xc0,0x83,0x36,0x86,0x07,
+    0x41,0x60,0x60,0x00,0x8a,0x07,0x8f,0x4f,0x83,0x39,0x85,0x07,0x03,0x41,0x80,0x80,
+    0x05,0x85,0x07,0x41,0xc0,0xc0,0x8b,0x07,0x83,0x47,0x41,0x02,0x02,0x85,0x07,0x41,
+    0x30,0x30,0x83,0x39,0x85,0x07,0x03,0x09,0x89,0x47,0x84,0x57,0x80,0x07,0x83,0x47,
+    0x41,0x06,0x06,0x85,0x07,0x41,0x60,0x60,0x83,0x39,0x85,0x07,0x03,0x01,0x83,0x27,
+    0x8b,0x07,0x84,0x57,0x80,0x07,0x83,0x47,0x41,0x0c,0x0c,0x85,0x07,0x41,0xc0,0xc0,
+    0x83,0x39,0x85,0x07,0x03,0x83,0x35,0x83,0x2f,0x85,0x07,0x81,0x27,0x8b,0x07,0x83,
+    0x27,0x81,0x07,0x41,0x80,0x80,0x83,0x39,0x85,0x07,0x04,0x83,0x35,0x81,0x27,0x85,
+    0x07,0x8b,0x2f,0x05,0x81,0x27,0x85,0x07,0x83,0x39,0x85,0x07,0x03,0x83,0x35,0x41,
+    0x18,0x18,0x85,0x07,0x8f,0x2f,0x03,0x81,0x2f,0x87,0x07,0x81,0x39,0x85,0x07,0x03,
+    0x83,0x35,0x41,0x30,0x30,0x85,0x07,0x05,0x81,0x57,0x89,0x07,0x83,0x2f,0x86,0x07,
+    0x80,0x39,0x85,0x07,0x03,0x83,0x35,0x41,0x60,0x60,0x85,0x07,0x05,0x81,0x57,0x89,
+    0x07,0x87,0x2f,0x83,0x4f,0x01,0x85,0x07,0x03,0x83,0x35,0x41,0xc0,0xc0,0x85,0x07,
+    0x87,0x57,0x89,0x07,0x09,0x80,0x4f,0x82,0x3a,0x85,0x07,0x03,0x83,0x35,0x41,0x80,
+    0x80,0x85,0x07,0x01,0x85,0x57,0x8b,0x07,0x07,0x80,0x4f,0x82,0x3a,0x85,0x07,0x03,
+    0x85,0x35,0x8b,0x3d,0x81,0x57,0x02,0x80,0x1f,0x85,0x07,0x88,0x57,0x82,0x3a,0x85,
+    0x07,0x03,0x82,0x35,0x80,0x1f,0x85,0x07,0x05,0x81,0x4f,0x02,0x80,0x1f,0x85,0x07,
+    0x88,0x57,0x82,0x3a,0x85,0x07,0x03,0x41,0x80,0x80,0x80,0x34,0x80,0x1f,0x85,0x07,
+    0x07,0x41,0xc0,0xc0,0x02,0x80,0x1f,0x85,0x07,0x88,0x57,0x82,0x3a,0x85,0x07,0x03,
+    0x82,0x34,0x80,0x1f,0x85,0x07,0x07,0x80,0x4f,0x01,0x80,0x1f,0x85,0x07,0x88,0x57,
+    0x82,0x3a,0x85,0x07,0x03,0x82,0x34,0x80,0x1f,0x85,0x07,0x0c,0x80,0x1f,0x80,0x57,
+    0x88,0x07,0x82,0x57,0x82,0x3a,0x85,0x07,0x03,0x82,0x34,0x80,0x1f,0x85,0x07,0x0c,
+    0x80,0x1f,0x80,0x57,0x88,0x07,0x03,0x41,0x02,0x82,0x82,0x3a,0x84,0x07,0x03,0x82,
+    0x34,0x80,0x1f,0x85,0x07,0x0c,0x80,0x1f,0x80,0x57,0x88,0x07,0x03,0x81,0x49,0x41,
+    0x82,0x82,0x85,0x07,0x03,0x82,0x34,0x80,0x1f,0x85,0x07,0x05,0x41,0x02,0x02,0x03,
+    0x81,0x1f,0x80,0x57,0x02,0x41,0x80,0x80,0x83,0x07,0x03,0x81,0x49,0x81,0x3b,0x83,
+    0x07,0x03,0x81,0x34,0x43,0xc2,0x02,0x80,0x80,0x85,0x07,0x87,0x63,0x83,0x07,0x80,
+    0x57,0x04,0x85,0x07,0x01,0x81,0x49,0x81,0x3b,0x83,0x07,0x03,0x44,0xc2,0xc2,0x00,
+    0x80,0x86,0x80,0x2d,0x85,0x07,0x87,0x63,0x83,0x07,0x80,0x57,0x04,0x85,0x07,0x83,
+    0x49,0x81,0x3b,0x83,0x07,0x03,0x41,0x86,0x86,0x83,0x2d,0x85,0x07,0x87,0x63,0x83,
+    0x07,0x41,0xc0,0xc0,0x03,0x82,0x5f,0x04,0x41,0x02,0x02,0x81,0x49,0x81,0x3b,0x83,
+    0x07,0x03,0x81,0x33,0x81,0x2d,0x85,0x07,0x87,0x63,0x83,0x07,0x41,0x80,0x80,0x03,
+    0x83,0x5f,0x03,0x43,0x06,0x06,0xc0,0xc0,0x83,0x43,0x83,0x07,0x03,0x81,0x33,0x81,
+    0x2d,0x85,0x07,0x03,0x83,0x5b,0x03,0x41,0x62,0x62,0x85,0x75,0x81,0x5f,0x01,0x81,
+    0x67,0x41,0x80,0x80,0x81,0x43,0x01,0x83,0x07,0x03,0x81,0x33,0x81,0x25,0x85,0x07,
+    0x03,0x81,0x5b,0x05,0x41,0xc6,0xc6,0x85,0x75,0x81,0x5f,0x01,0x83,0x67,0x81,0x43,
+    0x85,0x4b,0x04,0x81,0x33,0x81,0x25,0x85,0x07,0x03,0x81,0x5b,0x05,0x41,0x8c,0x8c,
+    0x85,0x75,0x81,0x5f,0x01,0x83,0x67,0x89,0x4b,0x03,0x81,0x33,0x81,0x25,0x85,0x07,
+    0x0b,0x89,0x29,0x41,0x60,0x60,0x03,0x83,0x67,0x81,0x43,0x41,0x02,0x02,0x83,0x07,
+    0x03,0x81,0x33,0x81,0x25,0x85,0x07,0x0d,0x87,0x75,0x41,0xc0,0xc0,0x03,0x83,0x67,
+    0x45,0x60,0x60,0x02,0x02,0x06,0x06,0x83,0x07,0x03,0x80,0x33,0x80,0x1d,0x87,0x07,
+    0x0b,0x81,0x21,0x85,0x07,0x41,0x80,0x80,0x03,0x83,0x67,0x45,0xc0,0xc0,0x06,0x06,
+    0x0c,0x0c,0x83,0x07,0x03,0x41,0x32,0x32,0x81,0x1d,0x87,0x07,0x0b,0x81,0x21,0x8b,
+    0x07,0x01,0x81,0x67,0x43,0x80,0x80,0x0c,0x0c,0x85,0x07,0x03,0x41,0x66,0x66,0x81,
+    0x1d,0x87,0x07,0x0b,0x81,0x21,0x8b,0x07,0x01,0x42,0x30,0x32,0x02,0x82,0x45,0x85,
+    0x07,0x03,0x41,0xcc,0xcc,0x81,0x1d,0x87,0x07,0x15,0x41,0x02,0x02,0x85,0x07,0x42,
+    0x60,0x66,0x06,0x02,0x41,0x30,0x30,0x85,0x07,0x03,0x41,0x98,0x98,0x80,0x14,0x88,
+    0x07,0x15,0x41,0x06,0x06,0x85,0x07,0x42,0xc0,0xcc,0x0c,0x02,0x41,0x60,0x60,0x85,
+    0x07,0x03,0x41,0x32,0x30,0x80,0x14,0x80,0x07,0x40,0x30,0x84,0x07,0x15,0x41,0x0c,
+    0x0c,0x85,0x07,0x42,0x80,0x98,0x18,0x02,0x41,0xc0,0xc0,0x85,0x07,0x03,0x41,0x66,
+    0x60,0x80,0x14,0x80,0x07,0x40,0x62,0x84,0x07,0x15,0x41,0x18,0x18,0x86,0x07,0x80,
+    0x68,0x01,0x41,0x80,0x80,0x85,0x07,0x03,0x41,0xcc,0xc0,0x81,0x14,0x42,0x80,0x80,
+    0xc6,0x84,0x07,0x40,0x02,0x13,0x83,0x2c,0x83,0x07,0x41,0x60,0x60,0x04,0x85,0x07,
+    0x03,0x40,0x98,0x84,0x49,0x40,0x8c,0x84,0x07,0x40,0x06,0x06,0x8b,0x47,0x88,0x34,
+    0x41,0xc0,0xc0,0x04,0x85,0x07,0x03,0x40,0x30,0x84,0x1c,0x40,0x18,0x84,0x07,0x40,
+    0x0c,0x03,0x8e,0x47,0x88,0x34,0x41,0x80,0x80,0x04,0x85,0x07,0x03,0x40,0x60,0x82,
+    0x14,0x82,0x47,0x82,0x07,0x40,0x18,0x03,0x8e,0x47,0x42,0x80,0x80,0x02,0x84,0x07,
+    0x0f,0x03,0x40,0xc0,0x84,0x14,0x40,0x60,0x84,0x07,0x40,0x30,0x03,0x96,0x47,0x01,
+    0x40,0x02,0x0e,0x03,0x40,0x80,0x87,0x47,0x01,0x83,0x47,0x01,0x99,0x47,0x8c,0x40,
+    0x03,0xae,0x47,0x8c,0x40,0x03,0xae,0x47,0x8c,0x40,0x03,0xae,0x47,0x8c,0x40,0x03,
+    0xae,0x47,0x8c,0x40,0x04,0xae,0x47,0x8c,0x40,0x03,0x2d,0x42,0x02,0x00,0x80,0x83,
+    0x40,0x08,0x03,0x25,0x85,0x6f,0x80,0x37,0x83,0x40,0x08,0x03,0xa6,0x37,0x04,0x81,
+    0x37,0x82,0x40,0x08,0x03,0xa7,0x37,0x03,0x82,0x37,0x81,0x40,0x08,0x03,0xa8,0x37,
+    0x02,0x83,0x37,0x80,0x40,0x08,0x03,0xa9,0x37,0x01,0x83,0x37,0x80,0x40,0x08,0x03,
+    0x83,0x3e,0xa4,0x37,0x00,0x85,0x37,0x40,0x80,0x08,0x03,0x83,0x3e,0xb3,0x37,0x03,
+    0x03,0x83,0x3e,0xb2,0x37,0x04,0x03,0x83,0x3e,0xb1,0x37,0x05,0x03,0x83,0x3e,0xb0,
+    0x37,0x06,0x03,0x83,0x3e,0xaf,0x37,0x07,0x03,0x83,0x3e,0x40,0x80,0x87,0x4f,0x2e,
+    0x03,0x8b,0x3e,0x80,0x4f,0x05,0xa6,0x4f,0x03,0x8b,0x3e,0x80,0x4f,0x04,0xa7,0x4f,
+    0x03,0x8b,0x3e,0x80,0x4f,0x03,0x9a,0x4f,0x8b,0x41,0x03,0x8b,0x3e,0x80,0x4f,0x02,
+    0x9b,0x4f,0x8b,0x41,0x03,0x8b,0x3e,0x80,0x4f,0x01,0x9c,0x4f,0x8b,0x41,0x03,0x8b,
+    0x3e,0x80,0x4f,0x00,0x91,0x4f,0x40,0x02,0x88,0x4f,0x83,0x41,0x07,0x04,0x06,0x8c,
+    0x4f,0x40,0x02,0x8c,0x4f,0x40,0x06,0x88,0x4f,0x83,0x41,0x07,0x03,0x00,0x8c,0x2f,
+    0x00,0x8c,0x2f,0x83,0x4f,0x40,0x0c,0x88,0x4f,0x83,0x41,0x07,0x03,0x83,0x3d,0x40,
+    0x06,0x0d,0x8e,0x5f,0x40,0x18,0x88,0x4f,0x83,0x41,0x07,0x03,0x83,0x3d,0x97,0x2f,
+    0x04,0x8a,0x2f,0x83,0x41,0x07,0x03,0x83,0x3d,0x99,0x2f,0x02,0x88,0x2f,0x85,0x41,
+    0x07,0x03,0x83,0x3d,0x8f,0x2f,0x40,0x02,0x0b,0x88,0x2f,0x85,0x41,0x07,0x03,0x83,
+    0x3d,0x8b,0x5f,0x81,0x2f,0x40,0x06,0x94,0x2f,0x40,0x02,0x0e,0x03,0x83,0x3d,0x8f,
+    0x5f,0x40,0x0c,0x15,0x81,0x57,0x8a,0x42,0x03,0x83,0x3d,0x87,0x5f,0x87,0x57,0x14,
+    0x81,0x57,0x8a,0x42,0x03,0x93,0x3d,0x81,0x57,0x01,0x89,0x27,0x88,0x57,0x83,0x42,
+    0x06,0x03,0x83,0x3d,0x8f,0x27,0x40,0x60,0x02,0x89,0x27,0x88,0x57,0x83,0x42,0x06,
+    0x03,0x40,0x80,0x82,0x3c,0x8f,0x27,0x40,0xc0,0x02,0x89,0x27,0x88,0x57,0x83,0x42,
+    0x06,0x03,0x83,0x3c,0x8f,0x27,0x40,0x80,0x02,0x89,0x27,0x88,0x57,0x83,0x42,0x06,
+    0x03,0x83,0x3c,0x40,0x18,0x14,0x81,0x27,0x40,0x02,0x8f,0x57,0x83,0x42,0x06,0x03,
+    0x83,0x3c,0x40,0x30,0x14,0x81,0x27,0x40,0x06,0x10,0x40,0x02,0x83,0x42,0x06,0x03,
+    0x83,0x3c,0x40,0x60,0x14,0x81,0x27,0x40,0x0c,0x0f,0x82,0x51,0x40,0x82,0x08,0x03,
+    0x83,0x3c,0x40,0xc0,0x8d,0x63,0x06,0x40,0x80,0x81,0x5f,0x0d,0x82,0x51,0x40,0x06,
+    0x08,0x03,0x81,0x3c,0x40,0x02,0x80,0x27,0x8f,0x63,0x86,0x5f,0x0d,0x82,0x51,0x40,
+    0x0c,0x08,0x03,0x40,0xc2,0x01,0x41,0x80,0x06,0x92,0x63,0x86,0x5f,0x05,0x8a,0x51,
+    0x40,0x18,0x08,0x03,0x40,0x86,0x8a,0x2d,0x04,0x8a,0x1f,0x40,0xc0,0x06,0x40,0x02,
+    0x8a,0x51,0x40,0x30,0x08,0x04,0x40,0x0c,0x8a,0x2d,0x04,0x8a,0x1f,0x40,0x80,0x06,
+    0x40,0x06,0x88,0x51,0x40,0x02,0x82,0x43,0x05,0x03,0x40,0x18,0x8a,0x2d,0x89,0x63,
+    0x8b,0x75,0x40,0x0c,0x88,0x51,0x40,0x06,0x80,0x43,0x07,0x03,0x81,0x3b,0x40,0x62,
+    0x07,0x88,0x63,0x8d,0x75,0x81,0x67,0x87,0x4b,0x40,0x80,0x08,0x03,0x81,0x3b,0x40,
+    0xc6,0x07,0x88,0x63,0x85,0x29,0x89,0x67,0x91,0x4b,0x03,0x81,0x3b,0x40,0x8c,0x0d,
+    0x92,0x29,0x40,0x60,0x06,0x40,0x02,0x8c,0x4b,0x03,0x40,0x8c,0x8a,0x25,0x06,0x90,
+    0x75,0x40,0xc0,0x06,0x40,0x06,0x82,0x4b,0x40,0x02,0x08,0x03,0x40,0x18,0x82,0x25,
+    0x40,0x02,0x0d,0x8e,0x75,0x01,0x40,0x80,0x06,0x40,0x0c,0x82,0x4b,0x40,0x06,0x08,
+    0x03,0x40,0x32,0x82,0x25,0x40,0x06,0x0d,0x8e,0x75,0x00,0x8a,0x6f,0x40,0x80,0x82,
+    0x45,0x05,0x03,0x40,0x66,0x82,0x25,0x40,0x0c,0x0d,0x8e,0x75,0x09,0x41,0x30,0x02,
+    0x85,0x45,0x05,0x03,0x40,0xcc,0x82,0x25,0x40,0x18,0x1e,0x40,0x02,0x08,0x41,0x60,
+    0x06,0x82,0x45,0x08,0x03,0x40,0x98,0x82,0x1c,0x40,0x30,0x1e,0x40,0x06,0x08,0x41,
+    0xc0,0x0c,0x82,0x45,0x08,0x00
+};
+
+__code uint anim_index[11] = {
+    0,2434,2507,2637,3072,6107,7514,7821,
+    11127,13968,17270
+};
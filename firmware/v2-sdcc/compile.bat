@@ -1 +1 @@
-sdcc -mmcs51 --std-c99 firmware.c
\ No newline at end of file
+sdcc -mmcs51 --std-c99 --iram-size 256 --xram-size 1024 firmware.c
\ No newline at end of file
@@ -1,28 +1,127 @@
 // Copyright(C) Tomas Uktveris 2015
 // www.wzona.info
 
+#ifdef HOST_BUILD
+#include "hostsdcc.h" // native build for cubesim, see software/host
+#else
 #include <mcs51/stc12.h>
+#endif
 
 #define uchar unsigned char
 #define uint unsigned int
+
+#include "assets.h" // code tables generated from firmware/assets/cube.assets
+#include "anim.h"   // packed animations made by software/host/cubepack
+
+///////////////////////////////////////////////////////////
+// memory layout of the state used by the two interrupts
+//
+// HOT_MEM   scalars read on every scan/uart interrupt
+// ISR_MEM   per layer tables of the scan interrupt (32 bytes)
+// RING_MEM  uart ring buffers (MAX_BUFFER bytes each)
+//
+// display always stays in xdata: 128 bytes do not fit next to the
+// stack in idata and the fb_ kernels address it with MOVX.
+//
+// RAM of the whole firmware in bytes, without TX_ENABLED / with it /
+// with TX_ENABLED and STATS. The STC12C5A60S2 has 256 bytes internal
+// and 1024 of xdata on chip; compile.bat makes SDCC fail past either.
+//
+// layout            data        idata     free         xdata
+// 0 MEM_COMPAT      63/67/83    0         183/179/163  544/672/672
+// 1 MEM_SPLIT       63/67/83    32        151/147/131  512/640/640
+// 2 MEM_INTERNAL    63/67/83    64/96/96  119/83/67    384/384/384
+//
+// data are the globals (11 of them HOT_MEM), idata the ISR_MEM tables
+// and in MEM_INTERNAL the rings. free is what register bank 0 and the
+// bit variables (up to 2 bytes) leave of the internal RAM for the overlaid
+// locals and the stack. xdata holds display, the rings, payload and the
+// work union of the frame generators (192).
+//
+// Per call the scan interrupt reads 8 display and 8 latched bytes,
+// 1 layer_reload and 1 fade_acc byte, the uart interrupt writes 1 ring
+// byte. Their clocks per layout are not known until measured on the
+// cube: define BENCH to have it print the mean and max of each.
+
+#define MEM_COMPAT      0
+#define MEM_SPLIT       1
+#define MEM_INTERNAL    2
+#define MEM_LAYOUT      MEM_SPLIT
+
+#if MEM_LAYOUT == MEM_COMPAT
+    #define HOT_MEM
+    #define ISR_MEM     __xdata
+    #define RING_MEM    __xdata
+    #define MAX_BUFFER  128     // UART ring buffer size, power of 2 up to 128
+#elif MEM_LAYOUT == MEM_SPLIT
+    #define HOT_MEM     __data
+    #define ISR_MEM     __idata
+    #define RING_MEM    __xdata
+    #define MAX_BUFFER  128
+#else
+    #define HOT_MEM     __data
+    #define ISR_MEM     __idata
+    #define RING_MEM    __idata
+    #define MAX_BUFFER  32      // 33 ms of 9600 bps traffic
+#endif
+
 __xdata volatile uchar display[2][8][8]; // 8x8x8 = (Z,Y,X)
-volatile uchar frame = 0;   // current visible frame (frontbuffer) index
-volatile uchar temp =  1;   // not visible frame (backbuffer) index
-volatile uchar layer = 0;   // layer, that is being re-painted
+HOT_MEM volatile uchar frame = 0;   // current visible frame (frontbuffer) index
+HOT_MEM volatile uchar temp =  1;   // not visible frame (backbuffer) index
+HOT_MEM volatile uchar layer = 0;   // layer, that is being re-painted
 
-#define MAX_BUFFER  128     // UART ring buffer size
-//#define TX_ENABLED        // uncomment to enable uart TX function
+#define SCAN_RELOAD 0xC0    // timer0 reload for a fixed layer on-time (64 x 32 counts)
+#define SCAN_PERIOD 512     // on-time of all 8 layers, in timer0 high byte steps
+#define SCAN_DROOP  64      // lit leds that halve a layer's brightness (bigger = weaker compensation)
 
-__xdata volatile uchar rx_buffer[MAX_BUFFER];
-volatile int rx_read = 0;
-volatile int rx_write = 0;
-volatile int rx_in = 0;
+ISR_MEM volatile uchar layer_reload[2][8];  // timer0 reload per layer of front/back buffer
+__bit scan_equalise = 0;            // scale layer on-time by its lit led count
+
+#define BRIGHT_MAX  15      // brightness levels 0 (dark) .. 15 (full, no blanking)
+
+__code uchar bright_gamma[BRIGHT_MAX+1] = { // lit part of a layer slot in 1/256, gamma 2.2
+    0,1,3,7,14,23,34,48,64,83,105,129,156,186,219,255
+};
+HOT_MEM volatile uchar bright = 255;        // bright_gamma[] value of current level
+volatile __bit scan_blank = 0;      // next timer0 interrupt ends the lit part of a slot
+HOT_MEM volatile uint blank_time = 0;       // timer0 counts the layer stays dark after that
+HOT_MEM volatile uchar fade = 0;            // crossfade: back buffer share of layer slots in 1/256, 0 - off
+ISR_MEM uchar fade_acc[8];                  // per layer crossfade accumulator
+ISR_MEM uchar latched[8];                   // row bytes the 573 latches hold
+volatile __bit latch_stale = 1;             // latches not loaded yet, load every row
+HOT_MEM volatile uchar refresh = 0;         // full cube refreshes, wraps around
+
+//#define TX_ENABLED        // uncomment to enable uart TX function (and to pass packets on to chained cubes)
+//#define BENCH             // uncomment to print kernel, life, anim and interrupt clocks at power up (needs TX_ENABLED)
+//#define FB_ASM            // uncomment to use the assembly frame kernels instead of the C loops (check with BENCH first)
+//#define STATS             // uncomment to count traffic, frames and scan overruns for CMD_STATS (needs TX_ENABLED)
+
+RING_MEM volatile uchar rx_buffer[MAX_BUFFER];
+HOT_MEM volatile uchar rx_read = 0;
+HOT_MEM volatile uchar rx_write = 0;
+HOT_MEM volatile uchar rx_in = 0;
 
 #ifdef TX_ENABLED
-    volatile uchar tx_buffer[MAX_BUFFER];
-    volatile int tx_read = 0;
-    volatile int tx_write = 0;
-    volatile int tx_out = 0;
+    RING_MEM volatile uchar tx_buffer[MAX_BUFFER];
+    HOT_MEM volatile uchar tx_read = 0;
+    HOT_MEM volatile uchar tx_write = 0;
+    HOT_MEM volatile uchar tx_out = 0;
+#endif
+
+#ifdef STATS
+#ifndef TX_ENABLED
+#error STATS replies over uart, define TX_ENABLED
+#endif
+// runtime counters, 16 bit and wrapping: the host takes the difference of
+// two CMD_STATS replies
+HOT_MEM volatile uint stat_rx = 0;          // bytes received
+HOT_MEM volatile uint stat_drop = 0;        // bytes lost, rx_buffer full
+HOT_MEM volatile uint stat_overrun = 0;     // scan interrupts entered late, the layer stayed on too long
+HOT_MEM volatile uint stat_refresh = 0;     // full cube refreshes
+uint stat_packets = 0;                      // packets run
+uint stat_crc = 0;                          // packets with a bad crc
+uint stat_frames = 0;                       // host frames shown (legacy, CMD_FRAME, CMD_MIRROR)
+uint stat_swaps = 0;                        // frames shown from any source
 #endif
 
 ///////////////////////////////////////////////////////////
@@ -37,9 +136,15 @@ void uart_isr() __interrupt (4)
 
         if (!(rx_write == rx_read && rx_in > 0)) {
             rx_buffer[rx_write] = SBUF;
-            rx_write = (rx_write+1)%MAX_BUFFER;
+            rx_write = (rx_write+1) & (MAX_BUFFER-1);
             rx_in++;
         }
+#ifdef STATS
+        else {
+            stat_drop++;
+        }
+        stat_rx++;
+#endif
     }
 #ifdef TX_ENABLED
     else if (TI) // byte was sent
@@ -48,7 +153,7 @@ void uart_isr() __interrupt (4)
 
         if (tx_out > 0) {
             SBUF = tx_buffer[tx_read];
-            tx_read = (tx_read+1)%MAX_BUFFER;
+            tx_read = (tx_read+1) & (MAX_BUFFER-1);
             tx_out--;
         }
     }
@@ -57,6 +162,19 @@ void uart_isr() __interrupt (4)
     EA = 1;
 }
 
+///////////////////////////////////////////////////////////
+// sleep until the next interrupt (scan timer, uart), timers and
+// uart keep running in IDLE mode
+#ifdef HOST_BUILD
+extern void idle();     // cubesim runs the interrupts up to the next one
+#else
+void idle()
+{
+    PCON |= 0x01;   // IDL
+    __asm__("nop");
+}
+#endif
+
 ///////////////////////////////////////////////////////////
 #ifdef TX_ENABLED
 // send a byte via uart (returns -1 if TX buffer full, otherwise 0 on success) [non blocking]
@@ -71,7 +189,7 @@ int send_uart(uchar dat)
     } 
     else {
         tx_buffer[tx_write] = dat;
-        tx_write = (tx_write+1)%MAX_BUFFER;
+        tx_write = (tx_write+1) & (MAX_BUFFER-1);
         tx_out++;
         res = 0;
 
@@ -90,10 +208,11 @@ void send_str(char* s)
 {
     while (*s) 
     {
-        while (send_uart(*s++) != 0) 
+        while (send_uart(*s) != 0) 
         {
-            __asm__("nop");
+            idle(); // wait for the tx interrupt
         }
+        s++;
     }
 }
 
@@ -103,7 +222,7 @@ void send_serial(uchar dat)
 {
     while(send_uart(dat) != 0) 
     {
-        __asm__("nop");
+        idle();
     }
 }
 #endif
@@ -123,7 +242,7 @@ int recv_uart()
     else 
     {   
         value = rx_buffer[rx_read];
-        rx_read = (rx_read+1)%MAX_BUFFER;
+        rx_read = (rx_read+1) & (MAX_BUFFER-1);
         rx_in--;
     }
     
@@ -138,19 +257,23 @@ uchar read_serial()
     int value;
     while ((value = recv_uart()) == -1) 
     {
-        __asm__("nop");
+        idle(); // woken by the uart (or scan) interrupt
     }
     return (uchar)(value & 0xFF);
 }
 
 ///////////////////////////////////////////////////////////
 
+#ifdef HOST_BUILD
+extern void delay5us(void); // cubesim moves its clock on 5 us
+#else
 void delay5us(void) // some magic wait - as in original code
 {
     unsigned char a,b;
     for(b=7; b>0; b--)
         for(a=2; a>0; a--);
 }
+#endif
 
 ///////////////////////////////////////////////////////////
 
@@ -161,17 +284,330 @@ void delay(uint i)
         delay5us();
     }
 }
+
+///////////////////////////////////////////////////////////
+// delay() that ends as soon as a byte is received, returns 1 then. It
+// sleeps in IDLE between the interrupts and counts the layer slots of the
+// scan (2048 us each), so it ends up to a slot later than delay(i) would.
+
+#define SLOT_UNITS      410     // delay5us() units in one layer slot
+
+__bit wait(uint i)
+{
+    uchar l = layer;
+    uint t = 0;
+    while (t < i)
+    {
+        if (rx_in > 0) return 1;
+        idle(); // woken by the scan (or uart) interrupt
+        if (layer != l)
+        {
+            l = layer;
+            t += SLOT_UNITS;
+        }
+    }
+    return 0;
+}
     
+///////////////////////////////////////////////////////////
+// 64 byte frame kernels, C loops unless FB_ASM is defined. The assembly
+// versions (Keil: framebuf.a51) have not run on a cube yet: a BENCH
+// build with FB_ASM checks each against its C loop and prints the clocks
+// of both. Every xdata access of compiled C reloads the one DPTR, these
+// keep src and dst in the two STC12 data pointers (AUXR1.0 selects) and
+// move 4 bytes per pointer switch. MOVX @Ri would need P2 as page, but
+// P2 drives the layer latches. The interrupts push/pop whichever DPTR
+// is selected, so switching is safe with interrupts on.
+//
+// Clocks of the assembly, summed from the STC12C5A60S2 instruction
+// timing table (not measured, the LCALL excluded): MOVX A,@DPTR 2,
+// MOVX @DPTR,A 3, INC DPTR, MOV A,Rn, MOV Rn,A, ORL/XRL A,Rn, CLR C,
+// RRC A 1, ADD A,direct, MOV A,direct, MOV Rn,#data 2, MOV direct,direct
+// 3, ORL/XRL/ANL direct,#data 4, DJNZ Rn 4, RET 4.
+//   fb_fill          296   8 x 36 + 8      4.6 per byte
+//   fb_copy          788  16 x 48 + 20    12.3 per byte
+//   fb_or, fb_xor    916  16 x 56 + 20    14.3 per byte
+//   fb_shl, fb_shr   582  16 x 36 + 6      9.1 per byte
+
+#if !defined(FB_ASM) || defined(HOST_BUILD)
+
+void fb_fill(volatile __xdata uchar *dst, uchar val)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] = val;
+}
+
+// dst = src
+void fb_copy(volatile __xdata uchar *dst, volatile __xdata uchar *src)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] = src[i];
+}
+
+// dst |= src, draws src over dst
+void fb_or(volatile __xdata uchar *dst, volatile __xdata uchar *src)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] |= src[i];
+}
+
+// dst ^= src, difference of two frames or a delta applied to a frame
+void fb_xor(volatile __xdata uchar *dst, volatile __xdata uchar *src)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] ^= src[i];
+}
+
+// move every voxel one step up x (bit x -> bit x+1), x = 7 drops out
+void fb_shl(volatile __xdata uchar *dst)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] <<= 1;
+}
+
+// move every voxel one step down x, x = 0 drops out
+void fb_shr(volatile __xdata uchar *dst)
+{
+    uchar i;
+    for (i=0; i<64; i++)
+        dst[i] >>= 1;
+}
+
+#else
+
+void fb_fill(volatile __xdata uchar *dst, uchar val) __naked
+{
+    dst; val; // dst in dptr, val in _fb_fill_PARM_2
+    __asm
+        mov     a,_fb_fill_PARM_2
+        mov     r7,#8
+    00001$:
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        movx    @dptr,a
+        inc     dptr
+        djnz    r7,00001$
+        ret
+    __endasm;
+}
+
+// dst = src
+void fb_copy(volatile __xdata uchar *dst, volatile __xdata uchar *src) __naked
+{
+    dst; src; // dst in dptr, src in _fb_copy_PARM_2
+    __asm
+        orl     _AUXR1,#0x01        ; dptr1 = src, dptr0 keeps dst
+        mov     dpl,_fb_copy_PARM_2
+        mov     dph,(_fb_copy_PARM_2 + 1)
+        mov     r7,#16
+    00001$:
+        movx    a,@dptr
+        mov     r2,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r3,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r4,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r5,a
+        inc     dptr
+        xrl     _AUXR1,#0x01        ; to dst
+        mov     a,r2
+        movx    @dptr,a
+        inc     dptr
+        mov     a,r3
+        movx    @dptr,a
+        inc     dptr
+        mov     a,r4
+        movx    @dptr,a
+        inc     dptr
+        mov     a,r5
+        movx    @dptr,a
+        inc     dptr
+        xrl     _AUXR1,#0x01        ; to src
+        djnz    r7,00001$
+        anl     _AUXR1,#0xFE        ; C code expects dptr0
+        ret
+    __endasm;
+}
+
+// dst |= src, draws src over dst
+void fb_or(volatile __xdata uchar *dst, volatile __xdata uchar *src) __naked
+{
+    dst; src;
+    __asm
+        orl     _AUXR1,#0x01
+        mov     dpl,_fb_or_PARM_2
+        mov     dph,(_fb_or_PARM_2 + 1)
+        mov     r7,#16
+    00001$:
+        movx    a,@dptr
+        mov     r2,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r3,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r4,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r5,a
+        inc     dptr
+        xrl     _AUXR1,#0x01
+        movx    a,@dptr
+        orl     a,r2
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        orl     a,r3
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        orl     a,r4
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        orl     a,r5
+        movx    @dptr,a
+        inc     dptr
+        xrl     _AUXR1,#0x01
+        djnz    r7,00001$
+        anl     _AUXR1,#0xFE
+        ret
+    __endasm;
+}
+
+// dst ^= src, difference of two frames or a delta applied to a frame
+void fb_xor(volatile __xdata uchar *dst, volatile __xdata uchar *src) __naked
+{
+    dst; src;
+    __asm
+        orl     _AUXR1,#0x01
+        mov     dpl,_fb_xor_PARM_2
+        mov     dph,(_fb_xor_PARM_2 + 1)
+        mov     r7,#16
+    00001$:
+        movx    a,@dptr
+        mov     r2,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r3,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r4,a
+        inc     dptr
+        movx    a,@dptr
+        mov     r5,a
+        inc     dptr
+        xrl     _AUXR1,#0x01
+        movx    a,@dptr
+        xrl     a,r2
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        xrl     a,r3
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        xrl     a,r4
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        xrl     a,r5
+        movx    @dptr,a
+        inc     dptr
+        xrl     _AUXR1,#0x01
+        djnz    r7,00001$
+        anl     _AUXR1,#0xFE
+        ret
+    __endasm;
+}
+
+// move every voxel one step up x (bit x -> bit x+1), x = 7 drops out
+void fb_shl(volatile __xdata uchar *dst) __naked
+{
+    dst;
+    __asm
+        mov     r7,#16
+    00001$:
+        movx    a,@dptr
+        add     a,acc
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        add     a,acc
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        add     a,acc
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        add     a,acc
+        movx    @dptr,a
+        inc     dptr
+        djnz    r7,00001$
+        ret
+    __endasm;
+}
+
+// move every voxel one step down x, x = 0 drops out
+void fb_shr(volatile __xdata uchar *dst) __naked
+{
+    dst;
+    __asm
+        mov     r7,#16
+    00001$:
+        movx    a,@dptr
+        clr     c
+        rrc     a
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        clr     c
+        rrc     a
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        clr     c
+        rrc     a
+        movx    @dptr,a
+        inc     dptr
+        movx    a,@dptr
+        clr     c
+        rrc     a
+        movx    @dptr,a
+        inc     dptr
+        djnz    r7,00001$
+        ret
+    __endasm;
+}
+#endif
+
 ///////////////////////////////////////////////////////////
 // assign all cube registers/rows the same value, usually 0, idx - 0/1 for front/back buffer
 void clear(char idx, char val) 
 {
-    uchar i,j;
-    for (j = 0; j < 8; ++j) {
-        for (i=0; i<8; ++i) {
-            display[idx][j][i] = val;
-        }
-    }
+    fb_fill(&display[idx][0][0], val);
 }
 
 ///////////////////////////////////////////////////////////
@@ -196,10 +632,58 @@ void line(uchar y, uchar z, uchar value)
     display[frame][z][y] = value;
 }
 
+///////////////////////////////////////////////////////////
+
+__code uchar nibble_bits[16] = { // lit leds in a nibble
+    0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4
+};
+
+///////////////////////////////////////////////////////////
+// compute layer on-times of a buffer, idx - 0/1 for front/back buffer
+// equalised: layer on-time ~ (SCAN_DROOP + lit leds), all layers together
+// still take SCAN_PERIOD so the refresh rate does not change
+void scan_times(uchar idx)
+{
+    uchar y, z, v;
+    uchar lit[8];
+    uint total = 0, used = 0, t;
+
+    if (!scan_equalise)
+    {
+        for (z=0; z<8; z++)
+            layer_reload[idx][z] = SCAN_RELOAD;
+        return;
+    }
+
+    for (z=0; z<8; z++)
+    {
+        lit[z] = 0;
+        for (y=0; y<8; y++)
+        {
+            v = display[idx][z][y];
+            lit[z] += nibble_bits[v & 0x0F] + nibble_bits[v >> 4];
+        }
+        total += SCAN_DROOP + lit[z];
+    }
+
+    for (z=0; z<7; z++)
+    {
+        t = (unsigned long)SCAN_PERIOD * (SCAN_DROOP + lit[z]) / total;
+        layer_reload[idx][z] = 256 - t;
+        used += t;
+    }
+    layer_reload[idx][7] = 256 - (SCAN_PERIOD - used); // rounding leftover
+}
+
 ///////////////////////////////////////////////////////////
 // swap back buffer with front buffer (i.e. show contents of back buffer)
 void swap() 
 {
+#ifdef STATS
+    stat_swaps++;
+#endif
+    scan_times(temp);
+    
     if (frame) {
         frame = 0;
         temp = 1;
@@ -214,15 +698,6 @@ void swap()
 
 ///////////////////////////////////////////////////////////
 
-__code uchar dat[128]= { /*railway*/
-    0x0,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,
-    0x1c,0x18,0x14,0x10,0xc,0x8,0x4,0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,0x35,0x31,
-    0x2d,0x29,0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x6f,0x8f,0x93,0x73,0x6f,0x8f,0x93,0x73,0x4a,0x6a,
-    0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,
-    0x59,0x39,0x35,0x31,0x2d,0x29,0x0,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,
-    0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0xc,0x8,0x4
-};
-
 /*
     cpp - distance from the midpoint
     le - draw or clean.
@@ -258,137 +733,1707 @@ __bit flash_2()
     {
         if (rx_in > 0) return 1; // RX command detected
         cirp(i-2,0,1);
-        delay(8000);
+        if (wait(8000)) return 1;
         cirp(i-1,0,0);
     }
     
-    delay(8000);
+    if (wait(8000)) return 1;
     
     for (i=0; i<136; i++) 
     {
         if (rx_in > 0) return 1; // RX command detected
         cirp(i,1,1);
-        delay(8000);
+        if (wait(8000)) return 1;
         cirp(i-8,1,0);
     }
     
-    delay(8000);
+    if (wait(8000)) return 1;
     
     for (i=129; i>0; i--) 
     {
         if (rx_in > 0) return 1; // RX command detected
         cirp(i-2,0,1);
-        delay(8000);
+        if (wait(8000)) return 1;
     }
     
-    delay(8000);
+    if (wait(8000)) return 1;
     
     for (i=0; i<128; i++) 
     {
         if (rx_in > 0) return 1; // RX command detected
         cirp(i-8,1,0);
-        delay(8000);
+        if (wait(8000)) return 1;
     }
     
-    delay(60000);
-    return 0;
+    return wait(60000);
 }
 
 ///////////////////////////////////////////////////////////
+// transitions between the front buffer and a newly received back buffer,
+// one step per cube refresh, swap() when done
 
-void main()
+#define TRANS_CUT       0   // plain swap
+#define TRANS_FADE      1   // crossfade, print() mixes front and back buffer
+#define TRANS_DISSOLVE  2   // voxels switch over in random (lfsr) order
+#define TRANS_WIPE      3   // planes switch over, param: axis 0-2 (x,y,z) | 4 - reverse
+
+uchar trans_kind = TRANS_CUT;   // transition armed for the next frame
+uchar trans_param = 0;
+uchar trans_len = 0;            // length in cube refreshes
+uchar trans_run = TRANS_CUT;    // transition in progress
+uchar trans_tick = 0;           // refreshes done
+uchar trans_last = 0;           // refresh count of the last step
+uint trans_done = 0;            // voxels / planes switched so far
+uint trans_lfsr = 1;
+__bit trans_running = 0;
+
+///////////////////////////////////////////////////////////
+// copy voxel v (bits: z3 y3 x3) from back buffer to front buffer
+void dissolve_voxel(uint v)
 {
-    int value;
-    
-    __bit uart_detected = 0;
-    __bit frame_started = 0;
+    uchar z = v >> 6;
+    uchar y = (v >> 3) & 0x07;
+    uchar m = 1 << (v & 0x07);
+    display[frame][z][y] = (display[frame][z][y] & ~m) | (display[temp][z][y] & m);
+}
+
+///////////////////////////////////////////////////////////
+// copy plane i along axis (0-2: x,y,z) from back buffer to front buffer
+void wipe_plane(uchar axis, uchar i)
+{
+    uchar y, z, m;
+    for (z=0; z<8; z++)
+    {
+        for (y=0; y<8; y++)
+        {
+            if (axis == 0) m = 1 << i;
+            else if ((axis == 1 && y == i) || (axis == 2 && z == i)) m = 0xFF;
+            else continue;
+            display[frame][z][y] = (display[frame][z][y] & ~m) | (display[temp][z][y] & m);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+// end a running transition, back buffer becomes visible
+void trans_finish()
+{
+    if (!trans_running) return;
+    trans_running = 0;
+    fade = 0;
+    swap();
+}
+
+///////////////////////////////////////////////////////////
+// back buffer holds a complete new frame: run the armed transition or swap
+void show_frame()
+{
+    uchar i;
+#ifdef STATS
+    stat_frames++;
+#endif
+    if (trans_kind == TRANS_CUT || trans_len == 0)
+    {
+        swap();
+        return;
+    }
     
-    uchar received = 0;
+    trans_run = trans_kind;
+    trans_kind = TRANS_CUT; // armed for one frame only
+    trans_tick = 0;
+    trans_done = 0;
+    trans_last = refresh;
+    trans_lfsr = (TL0 << 1) | 1; // any non zero seed
+    for (i=0; i<8; i++)
+        fade_acc[i] = 0;
+    trans_running = 1;
+}
+
+///////////////////////////////////////////////////////////
+// advance a running transition, at most once per cube refresh
+void trans_step()
+{
+    uint target;
+    uchar b;
     
-    // init uart - 9600bps@12.000MHz MCU
-    PCON &= 0x7F;       //Baudrate no doubled
-    SCON = 0x50;        //8bit and variable baudrate, 1 stop __bit, no parity
-    AUXR |= 0x04;       //BRT's clock is Fosc (1T)
-    BRT = 0xD9;         //Set BRT's reload value
-    AUXR |= 0x01;       //Use BRT as baudrate generator
-    AUXR |= 0x10;       //BRT running
+    if (!trans_running || refresh == trans_last) return;
+    trans_last = refresh;
     
-    ES = 1;  // enable UART interrupt
+    if (++trans_tick >= trans_len)
+    {
+        trans_finish();
+        return;
+    }
     
-    // setup timer0
-    TH0 = 0xc0;     // reload value
-    TL0 = 0;
-    TR0 = 1;        // timer0 start
+    switch (trans_run)
+    {
+        case TRANS_FADE:
+            fade = ((uint)trans_tick << 8) / trans_len;
+            break;
+        
+        case TRANS_DISSOLVE: // 9 bit lfsr x^9+x^5+1 visits all 511 non zero voxels once
+            target = (uint)511 * trans_tick / trans_len;
+            while (trans_done < target)
+            {
+                b = (trans_lfsr ^ (trans_lfsr >> 4)) & 1;
+                trans_lfsr = (trans_lfsr >> 1) | ((uint)b << 8);
+                dissolve_voxel(trans_lfsr);
+                trans_done++;
+            }
+            break;
+        
+        case TRANS_WIPE:
+            target = (uint)8 * trans_tick / trans_len;
+            while (trans_done < target)
+            {
+                b = trans_done;
+                if (trans_param & 4) b = 7 - b;
+                wipe_plane(trans_param & 3, b);
+                trans_done++;
+            }
+            break;
+    }
+}
+
+///////////////////////////////////////////////////////////
+// work areas of the frame generators. Life, the particle effects, the
+// text scroller and the anim player never run at the same time (every
+// command starting one stops the others), so their tables share one
+// block of xdata, each set up when its generator starts: 192 bytes
+// instead of 564.
+
+#define PARTICLES       24      // pool size
+#define TEXT_MAX        62      // longest string (packet payload - mode, period)
+
+typedef struct {
+    signed char x, y, z;    // position, 4.4 fixed point voxels
+    signed char vx, vy, vz; // velocity per tick, 4.4 fixed point
+    uchar life;             // ticks left, 0 - free slot
+    uchar kind;             // P_ behaviour
+} particle;
+
+__xdata union {
+    struct {
+        uchar born[27];     // neighbour counts giving birth
+        uchar keep[27];     // neighbour counts + 1 (self) keeping a cell alive
+        uchar h0[8][8];     // bit sliced sum of x-1, x, x+1 per row, bit 0
+        uchar h1[8][8];     // bit 1
+    } life;
+    particle pool[PARTICLES];
+    uchar text[TEXT_MAX];           // font5x7 char indexes
+    uchar anim_window[ANIM_WINDOW]; // anim history for matches
+} work;
+
+///////////////////////////////////////////////////////////
+// 3D cellular automaton running on the front buffer. Neighbour counts are
+// bit sliced: one byte op handles the 8 cells of a row, no per voxel loop.
+
+#define LIFE_WRAP       0x01    // flags: opposite faces are neighbours
+
+uchar life_period = 0;          // refreshes per generation, 0 - stopped
+uchar life_last = 0;            // refresh count of the last generation
+uchar life_flags = 0;
+uchar life_nborn = 0;
+uchar life_nkeep = 0;
+
+///////////////////////////////////////////////////////////
+// compute the next generation into the back buffer and show it
+void life_generation()
+{
+    uchar y, z, dy, dz, yy, zz, r, l, c, t, m, i, b, born, keep;
+    uchar s[5]; // bit sliced 3x3x3 sum (self included), 0..27
     
-    ET0 = 1; // enable timer0 interrupt
-    EA = 1;  // enable global interrupts
+    for (z=0; z<8; z++) // x-1, x, x+1 of every row as a 2 bit sliced sum
+    {
+        for (y=0; y<8; y++)
+        {
+            r = display[frame][z][y];
+            if (life_flags & LIFE_WRAP) {
+                l = (r << 1) | (r >> 7);
+                t = (r >> 1) | (r << 7);
+            }
+            else {
+                l = r << 1;
+                t = r >> 1;
+            }
+            work.life.h0[z][y] = r ^ l ^ t;
+            work.life.h1[z][y] = (r & l) | (t & (r ^ l));
+        }
+    }
     
-    // clear main buffer and back buffer
-    clear(frame, 0);
-    clear(temp, 0);
-
-    while(1) 
+    for (z=0; z<8; z++)
     {
-        if (uart_detected) // is the cube is being controlled via uart?
+        for (y=0; y<8; y++)
         {
-            value = read_serial(); // blocks until a byte comes
+            s[0] = s[1] = s[2] = s[3] = s[4] = 0;
             
-            if (!frame_started) 
-            {
-                if (value == 0xF2) // start receiving batch
-                { 
-                    frame_started = 1; // begin reiving frame data
-                    received = 0;        // no rows received
-                }
-            } 
-            else
+            for (dz=0; dz<3; dz++)
             {
-                if (received < 64) // full cube data still not processed
-                {
-                    display[temp][received/8][received%8] = value;
-                    received++; // one more row/byte received
-                }
+                if (!(life_flags & LIFE_WRAP) && ((z == 0 && dz == 0) || (z == 7 && dz == 2))) continue;
+                zz = (z + dz + 7) & 0x07;
                 
-                if (received >= 64) // full cube info received
+                for (dy=0; dy<3; dy++)
                 {
-                    swap();                      // show leds lights
-                    frame_started = 0; // need new frame data
+                    if (!(life_flags & LIFE_WRAP) && ((y == 0 && dy == 0) || (y == 7 && dy == 2))) continue;
+                    yy = (y + dy + 7) & 0x07;
+                    
+                    // s += 2 bit row sum, ripple carry over the 5 slices
+                    r = work.life.h0[zz][yy];
+                    l = work.life.h1[zz][yy];
+                    c = s[0] & r;
+                    s[0] ^= r;
+                    t = s[1] ^ l ^ c;
+                    c = (s[1] & l) | (c & (s[1] ^ l));
+                    s[1] = t;
+                    t = s[2] & c;
+                    s[2] ^= c;
+                    c = t;
+                    t = s[3] & c;
+                    s[3] ^= c;
+                    s[4] ^= t;
                 }
             }
-        } 
-        else
-        {
-            // run default animation if no UART commands
-            // if detected - switch working mode
-            uart_detected = flash_2();
+            
+            born = 0;
+            for (i=0; i<life_nborn; i++) // cells where the sum equals a birth count
+            {
+                m = 0xFF;
+                for (b=0; b<5; b++)
+                    m &= (work.life.born[i] & (1 << b)) ? s[b] : ~s[b];
+                born |= m;
+            }
+            
+            keep = 0;
+            for (i=0; i<life_nkeep; i++)
+            {
+                m = 0xFF;
+                for (b=0; b<5; b++)
+                    m &= (work.life.keep[i] & (1 << b)) ? s[b] : ~s[b];
+                keep |= m;
+            }
+            
+            r = display[frame][z][y];
+            display[temp][z][y] = (~r & born) | (r & keep);
         }
     }
+    
+    swap();
 }
 
 ///////////////////////////////////////////////////////////
+// run a generation when it is due
+void life_step()
+{
+    if (!life_period || trans_running) return;
+    if ((uchar)(refresh - life_last) < life_period) return;
+    life_last = refresh;
+    life_generation();
+}
 
-//P0;  //573 in
-//P1;  //uln2803
-//P2;  //573 LE
+///////////////////////////////////////////////////////////
+// particle engine: fixed pool, 4.4 fixed point position and velocity,
+// gravity and floor bounce, rendered into the back buffer every tick.
+// z counts down the cube as everywhere else: z=0 is the top layer, the
+// floor is z=FX_MAX and gravity adds to vz
 
-void print() __interrupt (1) // timer0 interrupt
+#define FX_ONE          16      // 1 voxel in 4.4 fixed point
+#define FX_MAX          (8*FX_ONE - 1)
+#define FX_GRAVITY      1       // velocity change per tick, towards z=FX_MAX
+
+#define FX_OFF          0
+#define FX_RAIN         1       // drops fall from the top layer
+#define FX_FOUNTAIN     2       // jets from the floor centre, bounce off walls
+#define FX_FIREWORKS    3       // rockets burst into sparks at their apex
+
+#define P_DROP          0       // dies on the floor
+#define P_BOUNCE        1       // bounces off floor and walls
+#define P_ROCKET        2       // bursts when it stops rising (vz >= 0)
+#define P_SPARK         3       // falls until its life runs out
+
+uchar fx_effect = FX_OFF;
+uchar fx_rate = 0;              // spawn chance per tick in 1/256
+uchar fx_period = 0;            // refreshes per tick
+uchar fx_last = 0;              // refresh count of the last tick
+uint rand_state = 0xACE1;
+
+///////////////////////////////////////////////////////////
+// xorshift pseudo random byte
+uchar rand8()
 {
-    uchar y;
-    P1 = 0;
+    rand_state ^= rand_state << 7;
+    rand_state ^= rand_state >> 9;
+    rand_state ^= rand_state << 8;
+    return rand_state & 0xFF;
+}
+
+///////////////////////////////////////////////////////////
+// random value -r..r
+signed char rand_range(uchar r)
+{
+    return (signed char)(rand8() % (2*r + 1)) - r;
+}
+
+///////////////////////////////////////////////////////////
+// put a particle into a free pool slot, dropped if the pool is full
+void spawn(signed char x, signed char y, signed char z, signed char vx, signed char vy, signed char vz, uchar life, uchar kind)
+{
+    uchar i;
+    for (i=0; i<PARTICLES; i++)
+    {
+        if (work.pool[i].life == 0)
+        {
+            work.pool[i].x = x;
+            work.pool[i].y = y;
+            work.pool[i].z = z;
+            work.pool[i].vx = vx;
+            work.pool[i].vy = vy;
+            work.pool[i].vz = vz;
+            work.pool[i].life = life;
+            work.pool[i].kind = kind;
+            return;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+// move one coordinate, reflect on the cube walls if bounce is set
+// returns the new position or -1 if the particle left the cube
+int fx_move(signed char p, signed char *v, uchar bounce)
+{
+    int n = (int)p + *v;
+    if (n >= 0 && n <= FX_MAX) return n;
+    if (!bounce) return -1;
+    *v = -*v;
+    return (n < 0) ? -n : 2*FX_MAX - n;
+}
+
+///////////////////////////////////////////////////////////
+// spawn new particles for the running effect
+void fx_emit()
+{
+    uchar i;
+    if (rand8() >= fx_rate) return;
     
-    // update one layer at a time
-    for (y=0; y<8; y++) 
+    switch (fx_effect)
     {
-        P2 = 1<<y;
-        delay(3);
-        P0 = display[frame][layer][y]; // shift every layer byte
-        delay(3);
+        case FX_RAIN:
+            spawn(rand8() & FX_MAX, rand8() & FX_MAX, 0, 0, 0, rand8() & 0x03, 255, P_DROP);
+            break;
+        
+        case FX_FOUNTAIN:
+            spawn(4*FX_ONE, 4*FX_ONE, FX_MAX, rand_range(3), rand_range(3), -9 - (signed char)(rand8() & 0x03), 60, P_BOUNCE);
+            break;
+        
+        case FX_FIREWORKS:
+            for (i=0; i<PARTICLES; i++) // one rocket at a time
+            {
+                if (work.pool[i].life && work.pool[i].kind == P_ROCKET) return;
+            }
+            spawn(FX_ONE + (rand8() % (6*FX_ONE)), FX_ONE + (rand8() % (6*FX_ONE)), FX_MAX, 0, 0, -10 - (signed char)(rand8() & 0x03), 255, P_ROCKET);
+            break;
     }
+}
+
+///////////////////////////////////////////////////////////
+// advance all particles by one tick and draw them into the back buffer
+void fx_tick()
+{
+    uchar i, j;
+    int n;
+    __xdata particle *p;
     
-    P1 = 1<<layer;
-    layer = (layer+1)%8; // rewind - ensure we loop in 0-7 layers
+    fx_emit();
     
-    // reset timer0
-    TH0 = 0xc0;
-    TL0 = 0;
+    for (i=0; i<PARTICLES; i++)
+    {
+        p = &work.pool[i];
+        if (p->life == 0) continue;
+        p->life--;
+        p->vz += FX_GRAVITY;
+        
+        if (p->kind == P_ROCKET && p->vz >= 0) // apex: burst into sparks
+        {
+            p->life = 0;
+            for (j=0; j<PARTICLES/2; j++)
+                spawn(p->x, p->y, p->z, rand_range(5), rand_range(5), rand_range(4), 12 + (rand8() & 0x07), P_SPARK);
+            continue;
+        }
+        
+        n = fx_move(p->x, &p->vx, p->kind == P_BOUNCE);
+        if (n < 0) { p->life = 0; continue; }
+        p->x = n;
+        n = fx_move(p->y, &p->vy, p->kind == P_BOUNCE);
+        if (n < 0) { p->life = 0; continue; }
+        p->y = n;
+        n = (int)p->z + p->vz;
+        if (n > FX_MAX) // floor
+        {
+            if (p->kind != P_BOUNCE) { p->life = 0; continue; }
+            n = FX_MAX;
+            p->vz = -p->vz * 3 / 4; // lose some energy
+        }
+        if (n < 0) n = 0; // ceiling
+        p->z = n;
+        
+        display[temp][p->z >> 4][p->y >> 4] |= 1 << (p->x >> 4);
+    }
+    
+    swap();
+}
+
+///////////////////////////////////////////////////////////
+// run a particle tick when it is due
+void fx_step()
+{
+    if (fx_effect == FX_OFF || trans_running) return;
+    if ((uchar)(refresh - fx_last) < fx_period) return;
+    fx_last = refresh;
+    fx_tick();
+}
+
+///////////////////////////////////////////////////////////
+// text scroller, renders an ASCII string with the font5x7 flash font
+
+#define TEXT_OFF        0
+#define TEXT_PERIMETER  1       // columns run around the 4 side faces
+#define TEXT_DEPTH      2       // chars fly from the back face to the front face
+#define TEXT_ROTATE     3       // chars spin on a plane turning around the centre
+
+uchar text_len = 0;
+uchar text_mode = TEXT_OFF;
+uchar text_period = 0;          // refreshes per step
+uchar text_last = 0;            // refresh count of the last step
+int text_pos = 0;               // step of the running mode
+int text_end = 0;               // steps of one pass
+uint text_width = 0;            // columns of the whole string incl. gaps
+
+///////////////////////////////////////////////////////////
+// light the bits of a font column (bit z = layer z) at x,y of the back buffer
+void text_draw(uchar x, uchar y, uchar bits)
+{
+    uchar z;
+    for (z=0; z<8; z++)
+    {
+        if (bits & (1 << z))
+            display[temp][z][y] |= 1 << x;
+    }
+}
+
+///////////////////////////////////////////////////////////
+// column k of the string, chars separated by one empty column
+uchar text_column(int k)
+{
+    uchar i, w;
+    uint s;
+    if (k < 0) return 0;
+    for (i=0; i<text_len; i++)
+    {
+        s = font5x7_index[work.text[i]];
+        w = font5x7_index[work.text[i] + 1] - s;
+        if (k < w) return font5x7[s + k];
+        k -= w + 1;
+        if (k < 0) return 0; // gap
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////
+// draw char i of the string on 8 plane columns given as nibbles x<<4 | y
+void text_char(uchar i, uchar *plane)
+{
+    uchar c, w, o;
+    uint s = font5x7_index[work.text[i]];
+    w = font5x7_index[work.text[i] + 1] - s;
+    o = (8 - w) / 2; // centre the glyph
+    for (c=0; c<w; c++)
+        text_draw(plane[o + c] >> 4, plane[o + c] & 0x0F, font5x7[s + c]);
+}
+
+///////////////////////////////////////////////////////////
+// draw the current step into the back buffer and show it
+void text_tick()
+{
+    uchar p, i;
+    uchar *plane;
+    uchar depth[8];
+    
+    switch (text_mode)
+    {
+        case TEXT_PERIMETER: // 28 column window around the outer ring (dat2)
+            for (p=0; p<28; p++)
+                text_draw(dat2[p] >> 5, (dat2[p] >> 2) & 0x07, text_column(text_pos + p));
+            break;
+        
+        case TEXT_DEPTH: // 8 steps per char, x-z plane moving from y=7 to y=0
+            for (i=0; i<8; i++)
+                depth[i] = (i << 4) | (7 - (text_pos & 0x07));
+            text_char(text_pos >> 3, depth);
+            break;
+        
+        case TEXT_ROTATE: // 16 angles per char
+            plane = (uchar *)&rot_xy[(text_pos & 0x0F) << 3];
+            text_char(text_pos >> 4, plane);
+            break;
+    }
+    
+    if (++text_pos >= text_end) // next pass
+        text_pos = (text_mode == TEXT_PERIMETER) ? -28 : 0;
+    swap();
+}
+
+///////////////////////////////////////////////////////////
+// run a text step when it is due
+void text_step()
+{
+    if (text_mode == TEXT_OFF || trans_running) return;
+    if ((uchar)(refresh - text_last) < text_period) return;
+    text_last = refresh;
+    text_tick();
+}
+
+///////////////////////////////////////////////////////////
+// animation player, streams the packed animations of anim.h into the
+// back buffer. Every frame is coded as its xor with the frame on display:
+// zero runs, literal bytes and matches into the last ANIM_WINDOW decoded
+// bytes (see cubepack.cpp for the format). Only ANIM_CHUNK bytes are
+// decoded per call so the uart is polled as often as before.
+
+#define ANIM_CHUNK 8            // bytes decoded per main loop pass
+#define ANIM_MIN_MATCH 3        // shortest match, token 0x80
+
+__code uchar *anim_src;         // next stream byte
+uchar anim_wpos = 0;            // window write position
+uchar anim_from = 0;            // window read position of a match
+uchar anim_token = 0;
+uchar anim_count = 0;           // bytes left in the token
+uchar anim_pos = 0;             // bytes of the back frame decoded, 64 - ready
+uchar anim_hold = 0;            // refreshes to keep the frame on display
+uchar anim_next = 0;            // hold of the frame being decoded
+uchar anim_last = 0;            // refresh count of the last swap
+uchar anim_num = 0;
+__bit anim_on = 0;
+__bit anim_loop = 0;
+__bit anim_key = 0;             // first frame, coded against an empty cube
+
+// rewind to the first frame of animation n
+void anim_start(uchar n)
+{
+    uint i;
+    for (i=0; i<ANIM_WINDOW; i++)
+        work.anim_window[i] = 0;
+    anim_src = &anim[anim_index[n]];
+    anim_next = *anim_src++;
+    anim_wpos = 0;
+    anim_count = 0;
+    anim_pos = 0;
+    anim_key = 1;
+}
+
+// decode the next bytes, swap when the frame is complete and due
+void anim_step()
+{
+    uchar n, value;
+    if (!anim_on) return;
+
+    for (n=0; n<ANIM_CHUNK && anim_pos<64; n++)
+    {
+        if (anim_count == 0) // next token
+        {
+            anim_token = *anim_src++;
+            if (anim_token & 0x80) {
+                anim_count = (anim_token & 0x7F) + ANIM_MIN_MATCH;
+                anim_from = anim_wpos - *anim_src++ - 1;
+            }
+            else {
+                anim_count = (anim_token & 0x3F) + 1;
+            }
+        }
+
+        if (anim_token & 0x80)
+            value = work.anim_window[anim_from++ & (ANIM_WINDOW - 1)];
+        else if (anim_token & 0x40)
+            value = *anim_src++;
+        else
+            value = 0;
+        work.anim_window[anim_wpos++ & (ANIM_WINDOW - 1)] = value;
+        anim_count--;
+
+        display[temp][anim_pos >> 3][anim_pos & 0x07] = value;
+        if (++anim_pos == 64 && !anim_key) // delta complete, apply it
+            fb_xor(&display[temp][0][0], &display[frame][0][0]);
+    }
+    if (anim_pos < 64 || (uchar)(refresh - anim_last) < anim_hold) return;
+
+    swap();
+    anim_last = refresh;
+    anim_hold = anim_next;
+    anim_pos = 0;
+    anim_key = 0;
+    anim_next = *anim_src++;
+    if (anim_next == 0) // end of the animation
+    {
+        if (anim_loop)
+            anim_start(anim_num);
+        else
+            anim_on = 0; // last frame stays on
+    }
+}
+
+///////////////////////////////////////////////////////////
+// serial protocol
+//
+// legacy frame:  0xF2, 64 raw row bytes (no escaping, no check)
+// packet:        0xF1, cmd, len, payload[len], crc8
+//
+// Inside a packet the bytes 0xF1, 0xF2 and 0xF3 are never sent raw,
+// they are sent as 0xF3 followed by the byte xor 0x20. A raw 0xF1/0xF2
+// therefore always marks a frame boundary and the receiver resyncs on it;
+// a 0xF2 inside a packet (a corrupted byte) only drops the packet, legacy
+// frames start between packets.
+// crc8 (poly 0x07, init 0) covers the unescaped cmd, len and payload bytes,
+// packets with a bad crc are dropped before anything is shown.
+//
+// addressed:     0xF1, cmd | 0x80, addr, len, payload[len], crc8
+//
+// For cubes chained TX -> RX on one line: a cube runs the packets for its
+// address and for ADDR_ALL, with TX_ENABLED every addressed packet that
+// is not only for itself is passed on byte by byte as it comes in. The
+// crc is made anew for the copy, one that came in bad goes out bad.
+// CMD_ENUM numbers the chain: every cube takes the address in the packet
+// and passes it on plus one. Packets without address are never passed on.
+
+#define FRAME_START     0xF2    // legacy raw frame marker
+#define PACKET_START    0xF1    // escaped + crc checked packet marker
+#define PACKET_ESC      0xF3    // escape marker, next byte is xor-ed with 0x20
+#define MAX_PAYLOAD     64      // largest packet payload
+
+#define CMD_FRAME       0x01    // payload: 64 row bytes -> back buffer, swap
+#define CMD_SCAN        0x02    // payload: 0 - fixed layer on-time, 1 - equalised
+#define CMD_BRIGHT      0x03    // payload: brightness level 0..BRIGHT_MAX
+#define CMD_TRANSITION  0x04    // payload: kind, param, refreshes - for the next frame
+#define CMD_LIFE        0x05    // payload: birth[4], survive[4] (bit n - n neighbours), period, flags
+#define CMD_PARTICLES   0x06    // payload: effect, spawn rate, period
+#define CMD_TEXT        0x07    // payload: mode, period, ASCII chars
+#define CMD_PLAY        0x08    // payload: animation (>= ANIM_COUNT stops), flags
+#define CMD_SAVE        0x09    // payload: flags, brightness, scan, baud, [boot cmd, boot payload]
+#define CMD_ENUM        0x0A    // payload: address of this cube, the next cube gets it + 1
+#define CMD_MIRROR      0x0B    // payload: axes, rows of the low half/quadrant/octant -> back buffer, swap
+#define CMD_STATS       0x0C    // payload: [flags] - reply with the counters (STATS), flags bit 0 - then zero them
+#define CMD_STATS_REPLY 0x0D    // sent by the cube: address, counters, to ADDR_ALL
+#define CMD_ADDRESSED   0x80    // cmd flag: an address byte follows the cmd
+#define ADDR_ALL        0xFF    // address of every cube in the chain
+#ifndef NO_LEGACY
+#define LEGACY_ENABLED          // comment out (or define NO_LEGACY) if the host only sends
+#endif                          // packets, a corrupted byte can then never open a raw frame
+
+#define RX_IDLE         0       // waiting for a start marker
+#define RX_RAW          1       // receiving legacy frame rows
+#define RX_CMD          2       // receiving packet command byte
+#define RX_LEN          3       // receiving packet payload length
+#define RX_DATA         4       // receiving packet payload
+#define RX_CRC          5       // receiving packet crc8
+#define RX_ADDR         6       // receiving packet address
+
+__code uchar crc8_table[256] = {
+    0x00,0x07,0x0e,0x09,0x1c,0x1b,0x12,0x15,0x38,0x3f,0x36,0x31,0x24,0x23,0x2a,0x2d,
+    0x70,0x77,0x7e,0x79,0x6c,0x6b,0x62,0x65,0x48,0x4f,0x46,0x41,0x54,0x53,0x5a,0x5d,
+    0xe0,0xe7,0xee,0xe9,0xfc,0xfb,0xf2,0xf5,0xd8,0xdf,0xd6,0xd1,0xc4,0xc3,0xca,0xcd,
+    0x90,0x97,0x9e,0x99,0x8c,0x8b,0x82,0x85,0xa8,0xaf,0xa6,0xa1,0xb4,0xb3,0xba,0xbd,
+    0xc7,0xc0,0xc9,0xce,0xdb,0xdc,0xd5,0xd2,0xff,0xf8,0xf1,0xf6,0xe3,0xe4,0xed,0xea,
+    0xb7,0xb0,0xb9,0xbe,0xab,0xac,0xa5,0xa2,0x8f,0x88,0x81,0x86,0x93,0x94,0x9d,0x9a,
+    0x27,0x20,0x29,0x2e,0x3b,0x3c,0x35,0x32,0x1f,0x18,0x11,0x16,0x03,0x04,0x0d,0x0a,
+    0x57,0x50,0x59,0x5e,0x4b,0x4c,0x45,0x42,0x6f,0x68,0x61,0x66,0x73,0x74,0x7d,0x7a,
+    0x89,0x8e,0x87,0x80,0x95,0x92,0x9b,0x9c,0xb1,0xb6,0xbf,0xb8,0xad,0xaa,0xa3,0xa4,
+    0xf9,0xfe,0xf7,0xf0,0xe5,0xe2,0xeb,0xec,0xc1,0xc6,0xcf,0xc8,0xdd,0xda,0xd3,0xd4,
+    0x69,0x6e,0x67,0x60,0x75,0x72,0x7b,0x7c,0x51,0x56,0x5f,0x58,0x4d,0x4a,0x43,0x44,
+    0x19,0x1e,0x17,0x10,0x05,0x02,0x0b,0x0c,0x21,0x26,0x2f,0x28,0x3d,0x3a,0x33,0x34,
+    0x4e,0x49,0x40,0x47,0x52,0x55,0x5c,0x5b,0x76,0x71,0x78,0x7f,0x6a,0x6d,0x64,0x63,
+    0x3e,0x39,0x30,0x37,0x22,0x25,0x2c,0x2b,0x06,0x01,0x08,0x0f,0x1a,0x1d,0x14,0x13,
+    0xae,0xa9,0xa0,0xa7,0xb2,0xb5,0xbc,0xbb,0x96,0x91,0x98,0x9f,0x8a,0x8d,0x84,0x83,
+    0xde,0xd9,0xd0,0xd7,0xc2,0xc5,0xcc,0xcb,0xe6,0xe1,0xe8,0xef,0xfa,0xfd,0xf4,0xf3
+};
+
+__xdata uchar payload[MAX_PAYLOAD];
+uchar rx_state = RX_IDLE;
+uchar rx_cmd = 0;
+uchar rx_len = 0;
+uchar rx_pos = 0;       // payload bytes / legacy rows received so far
+uchar rx_crc = 0;
+uchar rx_addr = 0;
+__bit rx_escape = 0;
+uchar cube_addr = 0;    // address in the chain, set by CMD_ENUM
+
+#ifdef STATS
+#define STATS_ZERO      0x01    // CMD_STATS flags: zero the counters after the reply
+#define STATS_LEN       17      // reply payload: address, 8 counters low byte first
+
+__bit stats_due = 0;    // CMD_STATS received, reply after the packet
+__bit stats_zero = 0;
+#endif
+
+///////////////////////////////////////////////////////////
+// mirrored frames: only the rows of voxels x, y or z < 4 are sent, the
+// other half of each flagged axis is its mirror image (x -> 7 - x). With
+// MIRROR_X a row is a nibble (low nibble first), the table below makes
+// the whole row out of it. Rows run z, then y, as in CMD_FRAME.
+
+#define MIRROR_X        0x01
+#define MIRROR_Y        0x02
+#define MIRROR_Z        0x04
+
+__code uchar mirror_len[8] = { // payload bytes after the axes byte
+    64, 32, 32, 16, 32, 16, 16, 8
+};
+
+__code uchar mirror_row[16] = { // nibble n | bit reversed n << 4
+    0x00,0x81,0x42,0xC3,0x24,0xA5,0x66,0xE7,0x18,0x99,0x5A,0xDB,0x3C,0xBD,0x7E,0xFF
+};
+
+///////////////////////////////////////////////////////////
+// expand a CMD_MIRROR payload into the back buffer
+void mirror(uchar axes)
+{
+    uchar y, z, y2, z2, ny, nz, row, i = 1;
+    __bit high = 0;
+    ny = (axes & MIRROR_Y) ? 4 : 8;
+    nz = (axes & MIRROR_Z) ? 4 : 8;
+    for (z=0; z<nz; z++)
+    {
+        for (y=0; y<ny; y++)
+        {
+            if (axes & MIRROR_X) {
+                row = mirror_row[high ? payload[i++] >> 4 : payload[i] & 0x0F];
+                high = !high;
+            }
+            else {
+                row = payload[i++];
+            }
+            y2 = (ny == 4) ? 7 - y : y;
+            z2 = (nz == 4) ? 7 - z : z;
+            display[temp][z][y] = row;
+            display[temp][z][y2] = row;
+            display[temp][z2][y] = row;
+            display[temp][z2][y2] = row;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+// settings in the eeprom (IAP data flash, sector 0), written by
+// CMD_SAVE and applied at power up by boot()
+//
+// 0 magic, 1 n, 2 flags, 3 brightness level, 4 scan mode, 5 baud,
+// 6 boot cmd, 7 boot len, 8 boot payload, [64 byte start frame],
+// 2+n crc8 of bytes 1 .. 1+n. The magic is programmed last, a save
+// cut short by a power loss leaves the cube on its defaults.
+
+#define IAP_WAIT        0x83    // IAPEN, wait states for 12 MHz
+#define IAP_READ        1
+#define IAP_PROGRAM     2       // ~55 us per byte
+#define IAP_ERASE       3       // ~21 ms per 512 byte sector
+
+#define CFG_ADDR        0x0000  // first eeprom sector
+#define CFG_MAGIC       0xC8
+#define CFG_UART        0x01    // flags: take frames at once, no demo
+#define CFG_FRAME       0x02    // flags: the frame on display is the start frame
+#define CFG_BOOT        8       // offset of the boot payload
+
+#define BAUDS           3
+
+__code uchar baud_reload[BAUDS] = { // BRT 1T reload with SMOD: 9600, 19200, 57600 bps
+    0xB2, 0xD9, 0xF3
+};
+
+uint cfg_addr;      // next eeprom byte of a save
+uchar cfg_crc;
+
+///////////////////////////////////////////////////////////
+// run one IAP command on an eeprom byte, the cpu holds until it is done
+void iap(uchar cmd, uint addr)
+{
+    IAP_CONTR = IAP_WAIT;
+    IAP_CMD = cmd;
+    IAP_ADDRL = addr;
+    IAP_ADDRH = addr >> 8;
+    EA = 0;             // 0x5A, 0xA5 must follow each other
+    IAP_TRIG = 0x5A;
+    IAP_TRIG = 0xA5;
+    __asm__("nop");
+#ifdef HOST_BUILD
+    host_iap();         // cubesim runs the command on its eeprom
+#endif
+    EA = 1;
+    IAP_CONTR = 0;      // IAP off, a stray trigger does nothing
+    IAP_CMD = 0;
+    IAP_ADDRH = 0x80;   // outside the eeprom
+}
+
+///////////////////////////////////////////////////////////
+// read an eeprom byte
+uchar iap_read(uint addr)
+{
+    iap(IAP_READ, addr);
+    return IAP_DATA;
+}
+
+///////////////////////////////////////////////////////////
+// program the next byte of a save (the sector is erased to 0xFF)
+void cfg_put(uchar value)
+{
+    IAP_DATA = value;
+    iap(IAP_PROGRAM, cfg_addr++);
+    cfg_crc = crc8_table[cfg_crc ^ value];
+}
+
+///////////////////////////////////////////////////////////
+// save a CMD_SAVE payload and the frame on display, takes up to 30 ms
+// with the cpu halted: bytes received meanwhile are lost
+void cfg_save(uchar len)
+{
+    uchar i, cmd, n;
+    cmd = (len > 4) ? payload[4] : 0;
+    if (cmd == CMD_SAVE) cmd = 0;
+    n = (cmd ? len - 5 : 0);
+    
+    P1 = 0; // layer off while the scan stands still
+    iap(IAP_ERASE, CFG_ADDR);
+    cfg_addr = CFG_ADDR + 1;
+    cfg_crc = 0;
+    cfg_put(CFG_BOOT - 2 + n + ((payload[0] & CFG_FRAME) ? 64 : 0));
+    for (i=0; i<4; i++)
+        cfg_put(payload[i]);
+    cfg_put(cmd);
+    cfg_put(n);
+    for (i=0; i<n; i++)
+        cfg_put(payload[5 + i]);
+    if (payload[0] & CFG_FRAME) {
+        for (i=0; i<64; i++)
+            cfg_put(display[frame][i >> 3][i & 0x07]);
+    }
+    IAP_DATA = cfg_crc;
+    iap(IAP_PROGRAM, cfg_addr);
+    IAP_DATA = CFG_MAGIC;
+    iap(IAP_PROGRAM, CFG_ADDR);
+}
+
+///////////////////////////////////////////////////////////
+// switch the uart to baud_reload[i]
+void baud_set(uchar i)
+{
+    AUXR &= ~0x10;      // BRT stopped
+    PCON |= 0x80;       // baudrate doubled (SMOD)
+    BRT = baud_reload[i];
+    AUXR |= 0x10;       // BRT running
+}
+
+///////////////////////////////////////////////////////////
+// run a packet that passed the crc check
+void execute(uchar cmd, uchar len)
+{
+    uchar i;
+    switch (cmd)
+    {
+        case CMD_FRAME:
+            if (len != 64) break;
+            trans_finish(); // back buffer is needed for the new frame
+            fx_effect = FX_OFF; // a host frame replaces every generator but life
+            text_mode = TEXT_OFF;
+            anim_on = 0;
+            fb_copy(&display[temp][0][0], payload);
+            show_frame(); // show leds lights
+            break;
+
+        case CMD_SCAN:
+            if (len != 1) break;
+            scan_equalise = payload[0] ? 1 : 0;
+            scan_times(frame); // apply to the frame already shown
+            break;
+
+        case CMD_BRIGHT:
+            if (len != 1 || payload[0] > BRIGHT_MAX) break;
+            bright = bright_gamma[payload[0]];
+            break;
+
+        case CMD_TRANSITION:
+            if (len != 3 || payload[0] > TRANS_WIPE) break;
+            trans_kind = payload[0];
+            trans_param = payload[1];
+            trans_len = payload[2];
+            break;
+
+        case CMD_LIFE: // the frame on display (or any later frame) is the seed
+            if (len != 10) break;
+            life_nborn = 0;
+            life_nkeep = 0;
+            for (i=0; i<27; i++)
+            {
+                if (payload[i >> 3] & (1 << (i & 0x07)))
+                    work.life.born[life_nborn++] = i;
+                if (payload[4 + (i >> 3)] & (1 << (i & 0x07)))
+                    work.life.keep[life_nkeep++] = i + 1;
+            }
+            life_period = payload[8];
+            life_flags = payload[9];
+            life_last = refresh;
+            fx_effect = FX_OFF;
+            text_mode = TEXT_OFF;
+            anim_on = 0;
+            break;
+
+        case CMD_PARTICLES:
+            if (len != 3 || payload[0] > FX_FIREWORKS) break;
+            for (i=0; i<PARTICLES; i++)
+                work.pool[i].life = 0;
+            fx_effect = payload[0];
+            fx_rate = payload[1];
+            fx_period = payload[2];
+            fx_last = refresh;
+            life_period = 0;
+            text_mode = TEXT_OFF;
+            anim_on = 0;
+            if (fx_effect == FX_OFF) {
+                swap(); // blank cube
+            }
+            break;
+
+        case CMD_TEXT:
+            if (len < 2 || payload[0] > TEXT_ROTATE) break;
+            text_len = len - 2;
+            text_width = 0;
+            for (i=0; i<text_len; i++)
+            {
+                work.text[i] = payload[2 + i] - 32; // font5x7 starts at space
+                if (work.text[i] > 126 - 32)
+                    work.text[i] = '?' - 32;
+                text_width += font5x7_index[work.text[i] + 1] - font5x7_index[work.text[i]] + 1;
+            }
+            text_mode = text_len ? payload[0] : TEXT_OFF;
+            text_period = payload[1];
+            text_last = refresh;
+            if (text_mode == TEXT_PERIMETER) {
+                text_pos = -28; // scroll in from an empty ring
+                text_end = text_width;
+            }
+            else {
+                text_pos = 0;
+                text_end = (text_mode == TEXT_DEPTH) ? text_len * 8 : text_len * 16;
+            }
+            life_period = 0;
+            fx_effect = FX_OFF;
+            anim_on = 0;
+            if (text_mode == TEXT_OFF) {
+                swap(); // blank cube
+            }
+            break;
+
+        case CMD_PLAY:
+            if (len != 2) break;
+            trans_finish(); // back buffer is needed for the frames
+            life_period = 0;
+            fx_effect = FX_OFF;
+            text_mode = TEXT_OFF;
+            anim_on = 0;
+            if (payload[0] >= ANIM_COUNT) break; // frame on display stays
+            anim_num = payload[0];
+            anim_loop = payload[1] & 0x01;
+            anim_hold = 0; // first frame shows as soon as it is decoded
+            anim_start(anim_num);
+            anim_on = 1;
+            break;
+
+        case CMD_MIRROR:
+            if (len < 1 || payload[0] > (MIRROR_X | MIRROR_Y | MIRROR_Z) || len != 1 + mirror_len[payload[0]]) break;
+            trans_finish(); // back buffer is needed for the new frame
+            fx_effect = FX_OFF;
+            text_mode = TEXT_OFF;
+            anim_on = 0;
+            mirror(payload[0]);
+            show_frame();
+            break;
+
+        case CMD_ENUM:
+            if (len != 1 || payload[0] == ADDR_ALL) break;
+            cube_addr = payload[0];
+            break;
+
+#ifdef STATS
+        case CMD_STATS: // replied once the packet is passed on, see receive()
+            if (len > 1) break;
+            stats_due = 1;
+            stats_zero = (len == 1 && (payload[0] & STATS_ZERO)) ? 1 : 0;
+            break;
+#endif
+
+        case CMD_SAVE: // brightness and scan apply now, the baud at power up
+            if (len < 4 || payload[1] > BRIGHT_MAX || payload[3] >= BAUDS) break;
+            bright = bright_gamma[payload[1]];
+            scan_equalise = payload[2] ? 1 : 0;
+            scan_times(frame);
+            cfg_save(len);
+            break;
+    }
+}
+
+#ifdef TX_ENABLED
+__bit rx_forward = 0;   // packet is passed on to the next cube
+uchar tx_crc = 0;       // crc of the passed on copy
+
+///////////////////////////////////////////////////////////
+// pass a packet byte on to the next cube, escaped as needed
+void forward(uchar value)
+{
+    tx_crc = crc8_table[tx_crc ^ value];
+    if (value == PACKET_START || value == FRAME_START || value == PACKET_ESC)
+    {
+        send_serial(PACKET_ESC);
+        value ^= 0x20;
+    }
+    send_serial(value);
+}
+#endif
+
+#ifdef STATS
+///////////////////////////////////////////////////////////
+// put a counter into the reply, low byte first
+void stats_put(uchar i, uint value)
+{
+    payload[i] = value;
+    payload[i + 1] = value >> 8;
+}
+
+///////////////////////////////////////////////////////////
+// reply to CMD_STATS. Sent to ADDR_ALL: cubes further down a chain pass it
+// on to the host (and ignore it themselves), the address says whose it is.
+// The payload buffer is free again once a packet has run.
+void stats_send()
+{
+    uchar i;
+    payload[0] = cube_addr;
+    EA = 0; // the counters of the interrupts as one snapshot
+    stats_put(1, stat_rx);
+    stats_put(3, stat_drop);
+    stats_put(5, stat_overrun);
+    stats_put(7, stat_refresh);
+    if (stats_zero) {
+        stat_rx = 0;
+        stat_drop = 0;
+        stat_overrun = 0;
+        stat_refresh = 0;
+    }
+    EA = 1;
+    stats_put(9, stat_packets);
+    stats_put(11, stat_crc);
+    stats_put(13, stat_frames);
+    stats_put(15, stat_swaps);
+    if (stats_zero) {
+        stat_packets = 0;
+        stat_crc = 0;
+        stat_frames = 0;
+        stat_swaps = 0;
+    }
+    stats_due = 0;
+
+    send_serial(PACKET_START);
+    tx_crc = 0;
+    forward(CMD_ADDRESSED | CMD_STATS_REPLY);
+    forward(ADDR_ALL);
+    forward(STATS_LEN);
+    for (i=0; i<STATS_LEN; i++)
+        forward(payload[i]);
+    forward(tx_crc);
+}
+#endif
+
+///////////////////////////////////////////////////////////
+// feed one received byte to the protocol state machine
+void receive(uchar value)
+{
+#ifdef LEGACY_ENABLED
+    if (rx_state == RX_RAW) // legacy frame data is never escaped
+    {
+        display[temp][rx_pos/8][rx_pos%8] = value;
+        if (++rx_pos >= 64) // full cube info received
+        {
+            show_frame();        // show leds lights
+            rx_state = RX_IDLE; // need new frame data
+        }
+        return;
+    }
+#endif
+
+    if (value == FRAME_START)
+    {
+        // never valid inside a packet: a corrupted byte drops the packet,
+        // a legacy frame only starts between packets
+        if (rx_state != RX_IDLE)
+        {
+            rx_state = RX_IDLE;
+            return;
+        }
+#ifdef LEGACY_ENABLED
+        // start receiving legacy batch
+        trans_finish(); // back buffer is needed for the new frame
+        fx_effect = FX_OFF;
+        text_mode = TEXT_OFF;
+        anim_on = 0;
+        rx_state = RX_RAW;
+        rx_pos = 0;
+#endif
+        return;
+    }
+
+    if (value == PACKET_START) // resync on every packet boundary
+    {
+        rx_state = RX_CMD;
+        rx_escape = 0;
+#ifdef TX_ENABLED
+        rx_forward = 0;
+#endif
+        return;
+    }
+
+    if (rx_state == RX_IDLE) return; // noise between frames
+
+    if (value == PACKET_ESC)
+    {
+        rx_escape = 1;
+        return;
+    }
+
+    if (rx_escape)
+    {
+        value ^= 0x20;
+        rx_escape = 0;
+        if (value < PACKET_START || value > PACKET_ESC) {
+            rx_state = RX_IDLE; // only markers are escaped: a corrupted escape
+            return;             // would shift the payload past the crc check
+        }
+    }
+
+    switch (rx_state)
+    {
+        case RX_CMD:
+            rx_cmd = value;
+            rx_crc = crc8_table[value];
+            rx_state = (value & CMD_ADDRESSED) ? RX_ADDR : RX_LEN;
+            break;
+
+        case RX_ADDR:
+            rx_addr = value;
+            rx_crc = crc8_table[rx_crc ^ value];
+            rx_state = RX_LEN;
+#ifdef TX_ENABLED
+            if (value != cube_addr) { // for other cubes or all of them
+                rx_forward = 1;
+                send_serial(PACKET_START);
+                tx_crc = 0;
+                forward(rx_cmd);
+                forward(value);
+            }
+#endif
+            break;
+
+        case RX_LEN:
+            if (value > MAX_PAYLOAD) {
+                rx_state = RX_IDLE; // corrupted length, wait for next marker
+                break;
+            }
+            rx_len = value;
+            rx_pos = 0;
+            rx_crc = crc8_table[rx_crc ^ value];
+            rx_state = (value > 0) ? RX_DATA : RX_CRC;
+#ifdef TX_ENABLED
+            if (rx_forward) forward(value);
+#endif
+            break;
+
+        case RX_DATA:
+            payload[rx_pos++] = value;
+            rx_crc = crc8_table[rx_crc ^ value];
+            if (rx_pos >= rx_len) {
+                rx_state = RX_CRC;
+            }
+#ifdef TX_ENABLED
+            if (rx_forward) {
+                if (rx_pos == 1 && rx_cmd == (CMD_ADDRESSED | CMD_ENUM))
+                    value++; // next cube, next address
+                forward(value);
+            }
+#endif
+            break;
+
+        case RX_CRC:
+            if (value == rx_crc && (!(rx_cmd & CMD_ADDRESSED) || rx_addr == cube_addr || rx_addr == ADDR_ALL)) {
+#ifdef STATS
+                stat_packets++;
+#endif
+                execute(rx_cmd & ~CMD_ADDRESSED, rx_len);
+            }
+#ifdef STATS
+            if (value != rx_crc) stat_crc++;
+#endif
+#ifdef TX_ENABLED
+            if (rx_forward) forward((value == rx_crc) ? tx_crc : tx_crc ^ 0xFF);
+#endif
+#ifdef STATS
+            if (stats_due) stats_send(); // not inside the copy passed on
+#endif
+            rx_state = RX_IDLE;
+            break;
+    }
+}
+
+///////////////////////////////////////////////////////////
+// apply the settings saved by CMD_SAVE, show the start frame and run the
+// boot packet. Returns 1 if the cube takes frames at once (no demo).
+__bit boot()
+{
+    uchar i, n, crc, flags, len;
+    if (iap_read(CFG_ADDR) != CFG_MAGIC) return 0; // never saved
+    n = iap_read(CFG_ADDR + 1);
+    crc = crc8_table[n];
+    for (i=0; i<n; i++)
+        crc = crc8_table[crc ^ iap_read(CFG_ADDR + 2 + i)];
+    if (crc != iap_read(CFG_ADDR + 2 + n)) return 0;
+    
+    flags = iap_read(CFG_ADDR + 2);
+    len = iap_read(CFG_ADDR + 7);
+    if (len > MAX_PAYLOAD || n != CFG_BOOT - 2 + len + ((flags & CFG_FRAME) ? 64 : 0)) return 0;
+    
+    i = iap_read(CFG_ADDR + 3);
+    if (i <= BRIGHT_MAX) bright = bright_gamma[i];
+    scan_equalise = iap_read(CFG_ADDR + 4) ? 1 : 0;
+    i = iap_read(CFG_ADDR + 5);
+    if (i < BAUDS) baud_set(i);
+    
+    if (flags & CFG_FRAME) {
+        for (i=0; i<64; i++)
+            display[temp][i >> 3][i & 0x07] = iap_read(CFG_ADDR + CFG_BOOT + len + i);
+        swap();
+    }
+    for (i=0; i<len; i++)
+        payload[i] = iap_read(CFG_ADDR + CFG_BOOT + i);
+    execute(iap_read(CFG_ADDR + 6), len); // boot cmd 0 - none
+    return (flags & CFG_UART) != 0;
+}
+
+///////////////////////////////////////////////////////////
+// benchmark: with FB_ASM, clocks of every assembly frame kernel and of
+// the C loop it replaces, and whether both give the same frame; clocks
+// of a life generation and of anim frame decodes, then of the scan and
+// uart interrupts (raised by setting their flag), counted by timer1 with
+// only the measured code running
+#ifdef BENCH
+#ifndef TX_ENABLED
+#error BENCH prints over uart, define TX_ENABLED
+#endif
+
+void send_num(uint v)
+{
+    char s[6];
+    uchar i = 5;
+    s[5] = 0;
+    do {
+        s[--i] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    send_str(&s[i]);
+}
+
+void bench_start()
+{
+    EA = 0;
+    TH1 = 0;
+    TL1 = 0;
+    TR1 = 1;
+}
+
+uint bench_stop()
+{
+    TR1 = 0;
+    EA = 1;
+    return ((uint)TH1 << 8) | TL1;
+}
+
+// clocks of one interrupt raised by software: 1 - scan, 2 - uart, 0 - none
+uint bench_irq(uchar which)
+{
+    TH1 = 0;
+    TL1 = 0;
+    TR1 = 1;
+    if (which == 1) TF0 = 1;
+    else if (which == 2) RI = 1;
+    __asm__("nop"); // taken after the next instruction
+    TR1 = 0;
+    return ((uint)TH1 << 8) | TL1;
+}
+
+// mean and max of n interrupts of one kind
+void bench_isr(char *name, uchar which, uchar n)
+{
+    uchar i;
+    uint t, empty, max = 0;
+    unsigned long sum = 0;
+    empty = bench_irq(0);
+    for (i=0; i<n; i++)
+    {
+        t = bench_irq(which) - empty;
+        sum += t;
+        if (t > max) max = t;
+    }
+    send_str(name);
+    send_str(" mean ");
+    send_num(sum / n);
+    send_str(" max ");
+    send_num(max);
+    send_str("\r\n");
+}
+
+#ifdef FB_ASM
+// the same pattern in both buffers and the payload before every kernel
+// and before its C loop
+void bench_load()
+{
+    uchar i;
+    for (i=0; i<64; i++) {
+        display[temp][i >> 3][i & 0x07] = 0x5A ^ (i * 37);
+        display[frame][i >> 3][i & 0x07] = 0xC3 ^ (i * 11);
+        payload[i] = i * 7;
+    }
+}
+
+// checksum of the back buffer, compares a kernel's result with its C loop's
+uint bench_sum()
+{
+    uchar i;
+    uint s = 0;
+    for (i=0; i<64; i++)
+        s = (s << 1 | s >> 15) ^ display[temp][i >> 3][i & 0x07];
+    return s;
+}
+
+void bench_report(char *name, uint t_asm, uint t_c, uint sum_asm)
+{
+    send_str(name);
+    send_str(" asm ");
+    send_num(t_asm);
+    send_str(" c ");
+    send_num(t_c);
+    send_str(sum_asm == bench_sum() ? " ok\r\n" : " differs\r\n");
+}
+#endif
+
+void bench()
+{
+    uchar i;
+    uint t, empty;
+#ifdef FB_ASM
+    uchar j;
+    uint s;
+#endif
+
+    TMOD = (TMOD & 0x0F) | 0x10;    // timer1 16 bit
+    AUXR |= 0x40;                   // timer1 counts clocks (1T)
+
+    bench_start();
+    empty = bench_stop();           // cost of the timing calls
+
+#ifdef FB_ASM
+    bench_load();
+    bench_start();
+    fb_fill(&display[temp][0][0], 0xA5);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (j = 0; j < 8; ++j) {
+        for (i=0; i<8; ++i) {
+            display[temp][j][i] = 0xA5;
+        }
+    }
+    bench_report("fill", t - empty, bench_stop() - empty, s);
+
+    bench_load();
+    bench_start();
+    fb_copy(&display[temp][0][0], payload);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (i=0; i<64; i++) {
+        display[temp][i/8][i%8] = payload[i];
+    }
+    bench_report("copy", t - empty, bench_stop() - empty, s);
+
+    bench_load();
+    bench_start();
+    fb_or(&display[temp][0][0], &display[frame][0][0]);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (j=0; j<8; j++)
+        for (i=0; i<8; i++)
+            display[temp][j][i] |= display[frame][j][i];
+    bench_report("or", t - empty, bench_stop() - empty, s);
+
+    bench_load();
+    bench_start();
+    fb_xor(&display[temp][0][0], &display[frame][0][0]);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (j=0; j<8; j++)
+        for (i=0; i<8; i++)
+            display[temp][j][i] ^= display[frame][j][i];
+    bench_report("xor", t - empty, bench_stop() - empty, s);
+
+    bench_load();
+    bench_start();
+    fb_shl(&display[temp][0][0]);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (j=0; j<8; j++)
+        for (i=0; i<8; i++)
+            display[temp][j][i] <<= 1;
+    bench_report("shl", t - empty, bench_stop() - empty, s);
+
+    bench_load();
+    bench_start();
+    fb_shr(&display[temp][0][0]);
+    t = bench_stop();
+    s = bench_sum();
+    bench_load();
+    bench_start();
+    for (j=0; j<8; j++)
+        for (i=0; i<8; i++)
+            display[temp][j][i] >>= 1;
+    bench_report("shr", t - empty, bench_stop() - empty, s);
+#endif
+
+    // one generation of rule B5/S45 with wrapped faces (all 26 neighbours,
+    // the slowest case), swap() included. It takes more than the 65536
+    // clocks timer1 holds, so timer1 counts 12 clock steps meanwhile.
+    for (i=0; i<64; i++) {
+        display[frame][i >> 3][i & 0x07] = 0x5A ^ (i * 37);
+    }
+    work.life.born[0] = 5;
+    work.life.keep[0] = 5 + 1;
+    work.life.keep[1] = 4 + 1;
+    life_nborn = 1;
+    life_nkeep = 2;
+    life_flags = LIFE_WRAP;
+    AUXR &= ~0x40;                  // timer1 counts clocks / 12
+    bench_start();
+    life_generation();
+    t = bench_stop();
+    AUXR |= 0x40;
+    send_str("life clocks/12 ");
+    send_num(t);
+    send_str(" generations/s at 12 MHz ");
+    send_num(1000000UL / t);
+    send_str("\r\n");
+    clear(frame, 0);
+
+    // the first two frames of animation 0 decoded (ANIM_CHUNK bytes a
+    // call, as the main loop does) and swapped: the key frame, then a
+    // delta frame with its xor onto the frame shown. Clocks / 12 again, a
+    // frame may well take more than the 65536 clocks of 1T mode.
+    anim_start(0);
+    anim_on = 1;
+    anim_hold = 0;
+    AUXR &= ~0x40;
+    bench_start();
+    do anim_step(); while (anim_pos);
+    t = bench_stop();
+    send_str("anim clocks/12 key ");
+    send_num(t);
+    anim_hold = 0;                  // due at once, refresh stands still
+    bench_start();
+    do anim_step(); while (anim_pos);
+    t = bench_stop();
+    AUXR |= 0x40;
+    anim_on = 0;
+    send_str(" delta ");
+    send_num(t);
+    send_str("\r\n");
+    clear(frame, 0);
+
+    clear(temp, 0);
+    while (tx_out > 0) { // let the report leave, TI would interrupt the uart runs
+        __asm__("nop");
+    }
+    delay(1000);    // last byte
+
+    // 32 scan interrupts: 4 refreshes worth of layers
+    TR0 = 0;        // timer0 only overflows when told to
+    ES = 0;
+    bench_isr("scan isr", 1, 32);
+    // 16 received bytes
+    ET0 = 0;
+    ES = 1;
+    while (tx_out > 0) { // let the report leave, TI would interrupt the uart runs
+        __asm__("nop");
+    }
+    delay(1000);    // last byte
+    bench_isr("uart isr", 2, 16);
+    EA = 0;
+    rx_read = 0;    // drop the bytes the runs received
+    rx_write = 0;
+    rx_in = 0;
+    EA = 1;
+    ET0 = 1;
+    TR0 = 1;
+}
+#endif
+
+///////////////////////////////////////////////////////////
+
+void main()
+{
+    int value;
+    __bit uart_detected = 0;
+
+    // init uart - 9600bps@12.000MHz MCU
+    PCON &= 0x7F;       //Baudrate no doubled
+    SCON = 0x50;        //8bit and variable baudrate, 1 stop __bit, no parity
+    AUXR |= 0x04;       //BRT's clock is Fosc (1T)
+    BRT = 0xD9;         //Set BRT's reload value
+    AUXR |= 0x01;       //Use BRT as baudrate generator
+    AUXR |= 0x10;       //BRT running
+    
+    ES = 1;  // enable UART interrupt
+    
+    // setup timer0
+    TH0 = SCAN_RELOAD;  // reload value
+    TL0 = 0;
+    TR0 = 1;        // timer0 start
+    
+    ET0 = 1; // enable timer0 interrupt
+    EA = 1;  // enable global interrupts
+    
+    // clear main buffer and back buffer
+    clear(frame, 0);
+    clear(temp, 0);
+    scan_times(frame);
+    scan_times(temp);
+#ifdef BENCH
+    bench();
+#endif
+    uart_detected = boot(); // saved settings, start frame and mode
+
+    while(1) 
+    {
+        if (uart_detected) // is the cube is being controlled via uart?
+        {
+            value = recv_uart();
+            if (value != -1) {
+                receive(value);
+            }
+            trans_step(); // runs between received bytes
+            if (rx_state != RX_RAW) { // legacy frame is being written to the back buffer
+                life_step();
+                fx_step();
+                text_step();
+                anim_step();
+            }
+            // nothing left until the next interrupt: a received byte, or a
+            // refresh that makes a step due (a byte arriving right before
+            // this waits for the next scan interrupt, < 2 ms)
+            if (rx_in == 0 && !(anim_on && anim_pos < 64)) {
+                idle();
+            }
+        } 
+        else
+        {
+            // run default animation if no UART commands
+            // if detected - switch working mode
+            uart_detected = flash_2();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+//P0;  //573 in
+//P1;  //uln2803
+//P2;  //573 LE
+
+void print() __interrupt (1) // timer0 interrupt
+{
+    uchar y, src, row;
+    uint slot, on;
+    P1 = 0;
+#ifdef STATS
+    if (TH0) stat_overrun++; // timer0 counts on from 0: entered 32+ us late, held off by code with EA = 0
+#endif
+    
+    if (scan_blank) // lit part is over, keep the layer dark for the rest of its slot
+    {
+        scan_blank = 0;
+        on = 8192 - blank_time; // 13 bit timer0 start value
+        TH0 = on >> 5;
+        TL0 = on & 0x1F;
+        return;
+    }
+    
+    src = frame;
+    if (fade) // crossfade: show back buffer in fade/256 of this layer's slots
+    {
+        fade_acc[layer] += fade;
+        if (fade_acc[layer] < fade) src = temp;
+    }
+    
+    // update one layer at a time, rows the latches already hold are
+    // skipped: blank frames and layers repeating rows cost no loads
+    for (y=0; y<8; y++) 
+    {
+        row = display[src][layer][y];
+        if (row == latched[y] && !latch_stale) continue;
+        latched[y] = row;
+        P2 = 1<<y;
+        delay(3);
+        P0 = row; // shift every layer byte
+        delay(3);
+    }
+    latch_stale = 0;
+    
+    y = 256 - layer_reload[frame][layer]; // slot length in 32 count steps
+    slot = (uint)y << 5;
+    
+    if (bright == 255) // full brightness, no blanking
+    {
+        on = slot;
+    }
+    else // split slot into lit and blank part, total time stays the same
+    {
+        on = ((uint)y * bright) >> 3;
+        blank_time = slot - on;
+        scan_blank = (on > 0);
+    }
+    
+    if (on > 0)
+    {
+        P1 = 1<<layer;
+    }
+    else
+    {
+        on = slot; // level 0: layer stays dark for the whole slot
+    }
+    layer = (layer+1)%8; // rewind - ensure we loop in 0-7 layers
+    if (layer == 0)
+    {
+        refresh++;
+#ifdef STATS
+        stat_refresh++;
+#endif
+    }
+    
+    // reset timer0
+    on = 8192 - on;
+    TH0 = on >> 5;
+    TL0 = on & 0x1F;
 }
@@ -0,0 +1,72 @@
+// generated by cubeasset from firmware/assets/cube.assets - do not edit
+
+/* path railway */
+uchar code dat[128] = {
+    0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,
+    0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04,0x25,0x45,0x65,0x85,
+    0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,0x35,0x31,0x2d,0x29,
+    0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,0x6f,0x8f,0x93,0x73,
+    0x6f,0x8f,0x93,0x73,0x4a,0x6a,0x8a,0xaa,0xae,0xb2,0xb6,0x96,0x76,0x56,0x52,0x4e,
+    0x25,0x45,0x65,0x85,0xa5,0xc5,0xc9,0xcd,0xd1,0xd5,0xd9,0xb9,0x99,0x79,0x59,0x39,
+    0x35,0x31,0x2d,0x29,0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,
+    0xf4,0xf8,0xfc,0xdc,0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04
+};
+
+/* path xy */
+uchar code dat2[28] = {
+    0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xdc,
+    0xbc,0x9c,0x7c,0x5c,0x3c,0x1c,0x18,0x14,0x10,0x0c,0x08,0x04
+};
+
+/* font: 95 chars from 32, columns, bit z = row z */
+uchar code font5x7[422] = {
+    0x00,0x00,0x00,0x5f,0x07,0x00,0x07,0x14,0x7f,0x14,0x7f,0x14,0x24,0x2a,0x7f,0x2a,
+    0x12,0x23,0x13,0x08,0x64,0x62,0x36,0x49,0x55,0x22,0x50,0x05,0x03,0x1c,0x22,0x41,
+    0x41,0x22,0x1c,0x08,0x2a,0x1c,0x2a,0x08,0x08,0x08,0x3e,0x08,0x08,0x50,0x30,0x08,
+    0x08,0x08,0x08,0x08,0x60,0x60,0x20,0x10,0x08,0x04,0x02,0x3e,0x51,0x49,0x45,0x3e,
+    0x42,0x7f,0x40,0x42,0x61,0x51,0x49,0x46,0x21,0x41,0x45,0x4b,0x31,0x18,0x14,0x12,
+    0x7f,0x10,0x27,0x45,0x45,0x45,0x39,0x3c,0x4a,0x49,0x49,0x30,0x01,0x71,0x09,0x05,
+    0x03,0x36,0x49,0x49,0x49,0x36,0x06,0x49,0x49,0x29,0x1e,0x36,0x36,0x56,0x36,0x08,
+    0x14,0x22,0x41,0x14,0x14,0x14,0x14,0x14,0x41,0x22,0x14,0x08,0x02,0x01,0x51,0x09,
+    0x06,0x32,0x49,0x79,0x41,0x3e,0x7e,0x11,0x11,0x11,0x7e,0x7f,0x49,0x49,0x49,0x36,
+    0x3e,0x41,0x41,0x41,0x22,0x7f,0x41,0x41,0x22,0x1c,0x7f,0x49,0x49,0x49,0x41,0x7f,
+    0x09,0x09,0x01,0x01,0x3e,0x41,0x41,0x51,0x32,0x7f,0x08,0x08,0x08,0x7f,0x41,0x7f,
+    0x41,0x20,0x40,0x41,0x3f,0x01,0x7f,0x08,0x14,0x22,0x41,0x7f,0x40,0x40,0x40,0x40,
+    0x7f,0x02,0x04,0x02,0x7f,0x7f,0x04,0x08,0x10,0x7f,0x3e,0x41,0x41,0x41,0x3e,0x7f,
+    0x09,0x09,0x09,0x06,0x3e,0x41,0x51,0x21,0x5e,0x7f,0x09,0x19,0x29,0x46,0x46,0x49,
+    0x49,0x49,0x31,0x01,0x01,0x7f,0x01,0x01,0x3f,0x40,0x40,0x40,0x3f,0x1f,0x20,0x40,
+    0x20,0x1f,0x7f,0x20,0x18,0x20,0x7f,0x63,0x14,0x08,0x14,0x63,0x03,0x04,0x78,0x04,
+    0x03,0x61,0x51,0x49,0x45,0x43,0x7f,0x41,0x41,0x02,0x04,0x08,0x10,0x20,0x41,0x41,
+    0x7f,0x04,0x02,0x01,0x02,0x04,0x40,0x40,0x40,0x40,0x40,0x01,0x02,0x04,0x20,0x54,
+    0x54,0x54,0x78,0x7f,0x48,0x44,0x44,0x38,0x38,0x44,0x44,0x44,0x20,0x38,0x44,0x44,
+    0x48,0x7f,0x38,0x54,0x54,0x54,0x18,0x08,0x7e,0x09,0x01,0x02,0x08,0x14,0x54,0x54,
+    0x3c,0x7f,0x08,0x04,0x04,0x78,0x44,0x7d,0x40,0x20,0x40,0x44,0x3d,0x7f,0x10,0x28,
+    0x44,0x41,0x7f,0x40,0x7c,0x04,0x18,0x04,0x78,0x7c,0x08,0x04,0x04,0x78,0x38,0x44,
+    0x44,0x44,0x38,0x7c,0x14,0x14,0x14,0x08,0x08,0x14,0x14,0x18,0x7c,0x7c,0x08,0x04,
+    0x04,0x08,0x48,0x54,0x54,0x54,0x20,0x04,0x3f,0x44,0x40,0x20,0x3c,0x40,0x40,0x20,
+    0x7c,0x1c,0x20,0x40,0x20,0x1c,0x3c,0x40,0x30,0x40,0x3c,0x44,0x28,0x10,0x28,0x44,
+    0x0c,0x50,0x50,0x50,0x3c,0x44,0x64,0x54,0x4c,0x44,0x08,0x36,0x41,0x7f,0x41,0x36,
+    0x08,0x08,0x04,0x08,0x10,0x08
+};
+
+uint code font5x7_index[96] = {
+    0,3,4,7,12,17,22,27,29,32,35,40,45,47,52,54,
+    59,64,67,72,77,82,87,92,97,102,107,109,111,115,120,124,
+    129,134,139,144,149,154,159,164,169,174,177,182,187,192,197,202,
+    207,212,217,222,227,232,237,242,247,252,257,262,265,270,273,278,
+    283,286,291,296,301,306,311,316,321,326,329,333,337,340,345,350,
+    355,360,365,370,375,380,385,390,395,400,405,410,413,414,417,422
+};
+
+/* path nibble */
+uchar code rot_xy[128] = {
+    0x04,0x14,0x24,0x34,0x44,0x54,0x64,0x74,0x02,0x13,0x23,0x33,0x44,0x54,0x64,0x75,
+    0x11,0x22,0x22,0x33,0x44,0x55,0x55,0x66,0x20,0x31,0x32,0x33,0x44,0x45,0x46,0x57,
+    0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x50,0x41,0x42,0x43,0x34,0x35,0x36,0x27,
+    0x61,0x52,0x52,0x43,0x34,0x25,0x25,0x16,0x72,0x63,0x53,0x43,0x34,0x24,0x14,0x05,
+    0x73,0x63,0x54,0x44,0x34,0x24,0x14,0x04,0x75,0x64,0x54,0x44,0x33,0x23,0x13,0x02,
+    0x66,0x55,0x55,0x44,0x33,0x22,0x22,0x11,0x57,0x46,0x45,0x44,0x33,0x32,0x31,0x20,
+    0x47,0x46,0x45,0x44,0x43,0x32,0x31,0x30,0x27,0x36,0x35,0x34,0x43,0x42,0x41,0x50,
+    0x16,0x25,0x25,0x34,0x43,0x52,0x52,0x61,0x05,0x14,0x24,0x34,0x43,0x53,0x63,0x72
+};
+
@@ -0,0 +1,17 @@
+g++ -O2 -std=c++17 -o cubeasset cubeasset.cpp
+gcc -O2 -c -DHOST_BUILD -I. -x c ../../firmware/888.c -o 888.o && g++ -O2 -std=c++17 -o fx888 fx888.cpp 888.o
+g++ -O2 -std=c++17 -o cubepack cubepack.cpp
+g++ -O2 -std=c++17 -o cubechain cubechain.cpp
+g++ -O2 -std=c++17 -march=native -o voxelbench voxelbench.cpp
+g++ -O2 -std=c++17 -o cubeemu cubeemu.cpp
+g++ -O2 -std=c++17 -o cubeaudio cubeaudio.cpp
+g++ -O2 -std=c++17 -pthread -o cubevox cubevox.cpp
+g++ -O2 -std=c++17 -o cubecap cubecap.cpp
+g++ -O2 -std=c++17 -o cubereplay cubereplay.cpp
+g++ -O2 -std=c++17 -pthread -o cubepipe cubepipe.cpp
+g++ -O2 -std=c++17 -o cubecodec cubecodec.cpp
+g++ -O2 -std=c++17 -pthread -o cubeimport cubeimport.cpp
+g++ -O2 -std=c++17 -o fxgold fxgold.cpp 888.o
+g++ -O2 -std=c++17 -o cubestats cubestats.cpp
+gcc -O2 -c -DHOST_BUILD -I. -x c ../../firmware/v2-sdcc/firmware.c -o firmware.o && g++ -O2 -std=c++17 -o cubesim cubesim.cpp firmware.o
+gcc -O2 -c -DHOST_BUILD -DNO_LEGACY -I. -x c ../../firmware/v2-sdcc/firmware.c -o firmware_nl.o && g++ -O2 -std=c++17 -o cubesim_nolegacy cubesim.cpp firmware_nl.o
@@ -0,0 +1,389 @@
+// cubeasset - compiles bitmap and path descriptions (*.assets) into the
+// code-memory tables used by the ledcube firmware.
+//
+// usage: cubeasset [-t keil|sdcc] [-a name]... [-o out.h] file.assets
+//
+// Asset kinds (see firmware/assets/cube.assets for the full syntax):
+//   glyphs NAME          8x8 bitmaps, 8 row bytes each  -> uchar NAME[n][8]
+//   banner NAME          8 rows of any width, 1 column byte per step (bit z = row z)
+//   font NAME FIRST      proportional glyphs, columns + start offsets per char
+//   path NAME FORMAT     3D points packed one byte each, FORMAT is
+//                          railway  x<<5 | y<<2 | z, second half stores 7-z
+//                          xy       x<<5 | y<<2
+//                          nibble   x<<4 | y
+//
+// The flash bytes used by every emitted asset are reported on stderr.
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Asset {
+    std::string kind;
+    std::string name;
+    std::string format;             // path format, font first char
+    std::vector<std::string> labels;
+    std::vector<unsigned char> bytes;
+    std::vector<unsigned> offsets;  // font: column offset of every char + end
+    size_t rows = 0;                // glyphs: number of 8 byte rows
+    int line = 0;
+};
+
+static std::string path_name;
+static int line_no = 0;
+
+///////////////////////////////////////////////////////////
+
+[[noreturn]] static void fail(const std::string &msg)
+{
+    std::cerr << path_name << ":" << line_no << ": " << msg << "\n";
+    std::exit(1);
+}
+
+///////////////////////////////////////////////////////////
+// read the next line that is not empty or a comment
+static bool next_line(std::istream &in, std::string &line)
+{
+    while (std::getline(in, line)) {
+        line_no++;
+        size_t p = line.find_first_not_of(" \t\r");
+        if (p == std::string::npos || line[p] == '#')
+            continue;
+        size_t e = line.find_last_not_of(" \t\r");
+        line = line.substr(p, e - p + 1);
+        return true;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////
+// read 8 bitmap rows, all of the same width
+static std::vector<std::string> read_bitmap(std::istream &in, size_t max_width)
+{
+    std::vector<std::string> rows;
+    std::string line;
+    while (rows.size() < 8) {
+        if (!next_line(in, line))
+            fail("bitmap needs 8 rows");
+        if (line.size() > max_width || (!rows.empty() && line.size() != rows[0].size()))
+            fail("bad bitmap row width");
+        rows.push_back(line);
+    }
+    return rows;
+}
+
+///////////////////////////////////////////////////////////
+// column c of a bitmap as a byte, bit z = row z
+static unsigned char column(const std::vector<std::string> &rows, size_t c)
+{
+    unsigned char v = 0;
+    for (size_t z = 0; z < 8; z++)
+        if (rows[z][c] != '.')
+            v |= 1 << z;
+    return v;
+}
+
+///////////////////////////////////////////////////////////
+
+static void parse_glyphs(std::istream &in, Asset &a)
+{
+    std::string line;
+    while (next_line(in, line) && line != "end") {
+        if (line.compare(0, 6, "glyph ") != 0)
+            fail("expected 'glyph LABEL' or 'end'");
+        a.labels.push_back(line.substr(6));
+        for (const std::string &row : read_bitmap(in, 8)) {
+            unsigned char v = 0;
+            for (size_t x = 0; x < row.size(); x++)
+                if (row[x] != '.')
+                    v |= 1 << x;
+            a.bytes.push_back(v);
+        }
+        a.rows++;
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+static void parse_banner(std::istream &in, Asset &a)
+{
+    std::vector<std::string> rows = read_bitmap(in, 4096);
+    for (size_t c = 0; c < rows[0].size(); c++)
+        a.bytes.push_back(column(rows, c));
+    std::string line;
+    if (!next_line(in, line) || line != "end")
+        fail("expected 'end'");
+}
+
+///////////////////////////////////////////////////////////
+// proportional font: empty columns left and right of a glyph are dropped
+// (an empty glyph such as space keeps its full width), the decoder finds
+// char c at columns NAME_index[c - FIRST] .. NAME_index[c - FIRST + 1] - 1
+static void parse_font(std::istream &in, Asset &a)
+{
+    std::string line;
+    a.offsets.push_back(0);
+    while (next_line(in, line) && line != "end") {
+        if (line.compare(0, 6, "glyph ") != 0)
+            fail("expected 'glyph CHAR' or 'end'");
+        a.labels.push_back(line.substr(6));
+        std::vector<std::string> rows = read_bitmap(in, 8);
+        size_t from = 0, to = rows[0].size();
+        while (from < to && column(rows, from) == 0)
+            from++;
+        while (to > from && column(rows, to - 1) == 0)
+            to--;
+        if (from == to) { // empty glyph
+            from = 0;
+            to = rows[0].size();
+        }
+        for (size_t c = from; c < to; c++)
+            a.bytes.push_back(column(rows, c));
+        a.offsets.push_back(a.bytes.size());
+    }
+}
+
+///////////////////////////////////////////////////////////
+// 3D bresenham line from a (exclusive) to b (inclusive)
+static void add_line(std::vector<int> &pts, const int a[3], const int b[3])
+{
+    int d[3], s[3], p[3] = { a[0], a[1], a[2] };
+    int n = 0;
+    for (int i = 0; i < 3; i++) {
+        d[i] = std::abs(b[i] - a[i]);
+        s[i] = b[i] > a[i] ? 1 : -1;
+        if (d[i] > n)
+            n = d[i];
+    }
+    int err[3] = { n / 2, n / 2, n / 2 };
+    for (int step = 0; step < n; step++) {
+        for (int i = 0; i < 3; i++) {
+            err[i] -= d[i];
+            if (err[i] < 0) {
+                err[i] += n;
+                p[i] += s[i];
+            }
+        }
+        pts.insert(pts.end(), p, p + 3);
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+static void parse_path(std::istream &in, Asset &a)
+{
+    std::vector<int> pts;
+    std::vector<int> src_line;
+    std::string line;
+    while (next_line(in, line) && line != "end") {
+        bool to = line.compare(0, 2, "->") == 0;
+        std::istringstream ss(to ? line.substr(2) : line);
+        int p[3];
+        if (!(ss >> p[0] >> p[1] >> p[2]))
+            fail("expected 'x y z' or '-> x y z'");
+        for (int v : p)
+            if (v < 0 || v > 7)
+                fail("coordinate out of 0..7");
+        if (to) {
+            if (pts.empty())
+                fail("'->' needs a previous point");
+            int from[3] = { pts[pts.size() - 3], pts[pts.size() - 2], pts[pts.size() - 1] };
+            add_line(pts, from, p);
+        }
+        else {
+            pts.insert(pts.end(), p, p + 3);
+        }
+        src_line.resize(pts.size() / 3, line_no);
+    }
+
+    size_t n = pts.size() / 3;
+    for (size_t i = 0; i < n; i++) {
+        int x = pts[i*3], y = pts[i*3+1], z = pts[i*3+2];
+        line_no = src_line[i];
+        if (a.format == "railway") {
+            if (i >= n / 2)
+                z = 7 - z; // second half is mirrored back by the decoder
+            if (z > 3)
+                fail("railway point " + std::to_string(i) + ": z must be 0..3 in the first and 4..7 in the second half");
+            a.bytes.push_back(x << 5 | y << 2 | z);
+        }
+        else if (a.format == "xy" || a.format == "nibble") {
+            if (z != 0)
+                fail(a.format + " path point " + std::to_string(i) + " must have z = 0");
+            a.bytes.push_back(a.format == "xy" ? (x << 5 | y << 2) : (x << 4 | y));
+        }
+        else {
+            line_no = a.line;
+            fail("unknown path format '" + a.format + "'");
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+static std::vector<Asset> parse(const std::string &file)
+{
+    std::ifstream in(file);
+    if (!in)
+        fail("cannot open");
+
+    std::vector<Asset> assets;
+    std::string line;
+    while (next_line(in, line)) {
+        Asset a;
+        std::istringstream ss(line);
+        ss >> a.kind >> a.name >> a.format;
+        a.line = line_no;
+        if (a.name.empty())
+            fail("expected 'KIND NAME'");
+        if (a.kind == "glyphs")
+            parse_glyphs(in, a);
+        else if (a.kind == "banner")
+            parse_banner(in, a);
+        else if (a.kind == "font")
+            parse_font(in, a);
+        else if (a.kind == "path")
+            parse_path(in, a);
+        else
+            fail("unknown asset kind '" + a.kind + "'");
+        assets.push_back(a);
+    }
+    return assets;
+}
+
+///////////////////////////////////////////////////////////
+// bytes as C initializer lines, 16 per line, more - a comma follows the last one
+static void emit_bytes(std::ostream &out, const std::vector<unsigned char> &bytes, size_t from, size_t n, bool more)
+{
+    char hex[8];
+    for (size_t i = 0; i < n; i++) {
+        if (i % 16 == 0)
+            out << "    ";
+        std::snprintf(hex, sizeof(hex), "0x%02x", bytes[from + i]);
+        out << hex << (i + 1 < n || more ? "," : "");
+        if (i % 16 == 15 || i + 1 == n)
+            out << "\n";
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+static size_t emit(std::ostream &out, const Asset &a, bool sdcc)
+{
+    const std::string type = sdcc ? "__code uchar " : "uchar code ";
+    size_t size = a.bytes.size();
+
+    if (a.kind == "glyphs") {
+        out << "/* " << a.kind << ":";
+        for (const std::string &l : a.labels)
+            out << " " << l;
+        out << " */\n" << type << a.name << "[" << a.rows << "][8] = {\n";
+        for (size_t g = 0; g < a.rows; g++)
+            emit_bytes(out, a.bytes, g * 8, 8, g + 1 < a.rows);
+        out << "};\n\n";
+    }
+    else if (a.kind == "font") {
+        bool wide = a.offsets.back() > 255;
+        out << "/* font: " << a.labels.size() << " chars from " << a.format << ", columns, bit z = row z */\n";
+        out << type << a.name << "[" << a.bytes.size() << "] = {\n";
+        emit_bytes(out, a.bytes, 0, a.bytes.size(), false);
+        out << "};\n\n";
+        out << (sdcc ? "__code " : "") << (wide ? "uint" : "uchar") << (sdcc ? " " : " code ")
+            << a.name << "_index[" << a.offsets.size() << "] = {\n";
+        for (size_t i = 0; i < a.offsets.size(); i++)
+            out << (i % 16 == 0 ? "    " : "") << a.offsets[i] << (i + 1 < a.offsets.size() ? "," : "")
+                << (i % 16 == 15 || i + 1 == a.offsets.size() ? "\n" : "");
+        out << "};\n\n";
+        size += a.offsets.size() * (wide ? 2 : 1);
+    }
+    else {
+        out << "/* " << a.kind << (a.format.empty() ? "" : " ") << a.format << " */\n";
+        out << type << a.name << "[" << a.bytes.size() << "] = {\n";
+        emit_bytes(out, a.bytes, 0, a.bytes.size(), false);
+        out << "};\n\n";
+    }
+    return size;
+}
+
+///////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+    bool sdcc = false;
+    std::vector<std::string> only;
+    std::string out_name, in_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc) {
+            std::string t = argv[++i];
+            if (t != "keil" && t != "sdcc") {
+                std::cerr << "unknown target " << t << "\n";
+                return 1;
+            }
+            sdcc = t == "sdcc";
+        }
+        else if (arg == "-a" && i + 1 < argc)
+            only.push_back(argv[++i]);
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else if (arg[0] != '-' && in_name.empty())
+            in_name = arg;
+        else {
+            std::cerr << "usage: cubeasset [-t keil|sdcc] [-a name]... [-o out.h] file.assets\n";
+            return 1;
+        }
+    }
+    if (in_name.empty()) {
+        std::cerr << "usage: cubeasset [-t keil|sdcc] [-a name]... [-o out.h] file.assets\n";
+        return 1;
+    }
+
+    path_name = in_name;
+    std::vector<Asset> assets = parse(in_name);
+
+    std::ostringstream out;
+    out << "// generated by cubeasset from " << in_name << " - do not edit\n\n";
+    size_t total = 0;
+    std::fprintf(stderr, "%-16s %-8s %8s %8s\n", "asset", "kind", "entries", "bytes");
+    for (const std::string &name : only) {
+        bool found = false;
+        for (const Asset &a : assets)
+            found |= a.name == name;
+        if (!found) {
+            std::cerr << in_name << ": no asset named " << name << "\n";
+            return 1;
+        }
+    }
+    for (const Asset &a : assets) {
+        if (!only.empty()) {
+            bool wanted = false;
+            for (const std::string &name : only)
+                wanted |= a.name == name;
+            if (!wanted)
+                continue;
+        }
+        size_t entries = a.kind == "glyphs" ? a.rows : a.kind == "font" ? a.labels.size() : a.bytes.size();
+        size_t size = emit(out, a, sdcc);
+        std::fprintf(stderr, "%-16s %-8s %8zu %8zu\n", a.name.c_str(), a.kind.c_str(), entries, size);
+        total += size;
+    }
+    std::fprintf(stderr, "%-16s %-8s %8s %8zu\n", "total", "", "", total);
+
+    if (out_name.empty()) {
+        std::cout << out.str();
+    }
+    else {
+        std::ofstream f(out_name, std::ios::binary);
+        f << out.str();
+        if (!f) {
+            std::cerr << "cannot write " << out_name << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,421 @@
+// cubeaudio - audio visualiser: reads PCM (a WAV file, or raw signed 16 bit
+// little endian samples) from a file or stdin, measures band energies with
+// an FFT over Hann windows overlapping by half and sends what they look
+// like as frame packets (cubelink.h) over the serial protocol. Frames go out
+// at the frame rate the line carries and show the highest levels of the
+// windows since the frame before, so short beats are not lost between them.
+//
+// usage: cubeaudio [-m mode] [-f fps] [-b bps] [-w window] [-r rate] [-C channels]
+//                  [-d range] [-x] [-o out] [-l log] [file.wav|-]
+//
+//   -m mode      columns - 64 bands on the 8x8 floor, column height = level
+//                bars    - 8 bands along x, older levels scroll back along y
+//                pulse   - a shell around the centre, radius = bass level
+//                (default columns)
+//   -f fps       frame rate (default: the most the line carries without
+//                queueing, up to 25)
+//   -b bps       line rate, for the default fps and the latency (default 9600)
+//   -w window    FFT size, power of 2 (default 2048), the hop is half of it
+//   -r rate      sample rate of raw input (default 44100)
+//   -C channels  channels of raw input, mixed to mono (default 1)
+//   -d range     dB shown between silence and the running peak (default 36)
+//   -x           as fast as possible (render to a file), without this a
+//                file is played in real time, as if it was heard
+//   -o out       file or (configured) serial device for the packets,
+//                default stdout
+//   -l log       per frame: <CLOCK_MONOTONIC us of the last input sample>
+//                <us when it is all on the line> <frame>, to join with the
+//                cubeemu log for end to end latency
+//
+// Latency is counted from reading the last sample of the hop that completes
+// a frame to the last byte of its frame packet leaving the line at bps (bytes queue behind earlier
+// frames as in the port's tx buffer). It has to stay within one frame
+// period, it is reported on stderr when the input ends. A window is centred
+// window/2 samples before its last sample, this delay comes on top.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cubelink.h"
+
+static const double PI = 3.14159265358979323846;
+
+// CLOCK_MONOTONIC in seconds, the clock of cubeemu logs
+static double now_s()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+///////////////////////////////////////////////////////////
+// PCM input: WAV (16 bit PCM or 32 bit float) or raw s16le, mixed to mono
+struct Input {
+    FILE *file = nullptr;
+    unsigned rate = 44100, channels = 1;
+    bool is_float = false;
+    std::vector<unsigned char> pending;     // header bytes read from raw input
+
+    bool read_exact(unsigned char *p, size_t n)
+    {
+        return std::fread(p, 1, n, file) == n;
+    }
+
+    // parse a WAV header if there is one, false on a broken one
+    bool open()
+    {
+        unsigned char h[12];
+        size_t n = std::fread(h, 1, 12, file);
+        if (n < 12 || std::memcmp(h, "RIFF", 4) || std::memcmp(h + 8, "WAVE", 4)) {
+            pending.assign(h, h + n);   // raw samples
+            return true;
+        }
+        for (;;) {
+            unsigned char c[8];
+            if (!read_exact(c, 8))
+                return false;
+            uint32_t size = c[4] | c[5] << 8 | c[6] << 16 | (uint32_t)c[7] << 24;
+            if (!std::memcmp(c, "data", 4))
+                return true;            // samples follow, the size may be a placeholder
+            std::vector<unsigned char> body(size + (size & 1));
+            if (!read_exact(body.data(), body.size()))
+                return false;
+            if (!std::memcmp(c, "fmt ", 4) && size >= 16) {
+                unsigned format = body[0] | body[1] << 8, bits = body[14] | body[15] << 8;
+                channels = body[2] | body[3] << 8;
+                rate = body[4] | body[5] << 8 | body[6] << 16 | (uint32_t)body[7] << 24;
+                if (format == 0xFFFE && size >= 26)     // WAVE_FORMAT_EXTENSIBLE
+                    format = body[24] | body[25] << 8;
+                is_float = format == 3;
+                if (!((format == 1 && bits == 16) || (format == 3 && bits == 32)) || !channels || !rate)
+                    return false;
+            }
+        }
+    }
+
+    // mono samples -1..1, fewer than n at the end of the input
+    size_t read(float *out, size_t n)
+    {
+        size_t frame = channels * (is_float ? 4 : 2);
+        std::vector<unsigned char> buf(n * frame);
+        size_t got = std::min(pending.size(), buf.size());
+        std::copy(pending.begin(), pending.begin() + got, buf.begin());
+        pending.erase(pending.begin(), pending.begin() + got);
+        while (got < buf.size()) {
+            size_t r = std::fread(buf.data() + got, 1, buf.size() - got, file);
+            if (r == 0)
+                break;
+            got += r;
+        }
+        size_t frames = got / frame;
+        for (size_t i = 0; i < frames; i++) {
+            float sum = 0;
+            for (unsigned c = 0; c < channels; c++) {
+                const unsigned char *p = &buf[i * frame + c * (frame / channels)];
+                if (is_float) {
+                    float v;
+                    std::memcpy(&v, p, 4);
+                    sum += v;
+                }
+                else
+                    sum += (int16_t)(p[0] | p[1] << 8) / 32768.0f;
+            }
+            out[i] = sum / channels;
+        }
+        return frames;
+    }
+};
+
+///////////////////////////////////////////////////////////
+// in place radix 2 FFT
+struct Fft {
+    size_t n;
+    std::vector<std::complex<float>> twiddle;
+    std::vector<size_t> reversed;
+
+    explicit Fft(size_t n_) : n(n_), twiddle(n_ / 2), reversed(n_)
+    {
+        for (size_t i = 0; i < n / 2; i++)
+            twiddle[i] = std::polar(1.0f, float(-2 * PI * i / n));
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < n)
+            bits++;
+        for (size_t i = 0; i < n; i++) {
+            size_t r = 0;
+            for (unsigned b = 0; b < bits; b++)
+                r |= ((i >> b) & 1) << (bits - 1 - b);
+            reversed[i] = r;
+        }
+    }
+
+    void run(std::vector<std::complex<float>> &x) const
+    {
+        for (size_t i = 0; i < n; i++)
+            if (i < reversed[i])
+                std::swap(x[i], x[reversed[i]]);
+        for (size_t len = 2; len <= n; len <<= 1) {
+            size_t step = n / len;
+            for (size_t i = 0; i < n; i += len)
+                for (size_t k = 0; k < len / 2; k++) {
+                    std::complex<float> t = twiddle[k * step] * x[i + k + len / 2];
+                    x[i + k + len / 2] = x[i + k] - t;
+                    x[i + k] += t;
+                }
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////
+// band levels 0..8 from a window of samples: log spaced bands from 40 Hz,
+// dB against a slowly falling running peak, which stays above 60 dB under a
+// full scale sine, levels fall at most 32 a second (hops = windows per second)
+struct Analyser {
+    Fft fft;
+    std::vector<float> hann;
+    std::vector<size_t> edges;          // bins of band b: edges[b] .. edges[b+1]-1
+    std::vector<float> shown;
+    std::vector<std::complex<float>> x;
+    double peak = -200, quiet, range, fall, peak_fall;
+
+    Analyser(size_t window, unsigned rate, unsigned bands, double range_, double hops)
+        : fft(window), hann(window), shown(bands, 0), x(window), range(range_),
+          fall(32 / hops), peak_fall(6 / hops)
+    {
+        quiet = 20 * std::log10(window / 4.0) - 60;    // a full scale sine gives window/4 in its bin
+        for (size_t i = 0; i < window; i++)
+            hann[i] = float(0.5 - 0.5 * std::cos(2 * PI * i / window));
+        double lo = 40, hi = std::min(16000.0, rate / 2.0), bin = double(rate) / window;
+        for (unsigned b = 0; b <= bands; b++) {
+            size_t e = size_t(lo * std::pow(hi / lo, double(b) / bands) / bin + 0.5);
+            if (b && e <= edges.back())
+                e = edges.back() + 1;   // a band gets one bin at least
+            edges.push_back(std::min(e, window / 2));
+        }
+    }
+
+    const std::vector<float> &levels(const float *samples)
+    {
+        for (size_t i = 0; i < x.size(); i++)
+            x[i] = samples[i] * hann[i];
+        fft.run(x);
+        std::vector<double> db(shown.size());
+        double top = -200;
+        for (size_t b = 0; b < shown.size(); b++) {
+            double e = 1e-12;
+            for (size_t k = edges[b]; k < edges[b + 1]; k++)
+                e += std::norm(x[k]);
+            db[b] = 10 * std::log10(e);
+            top = std::max(top, db[b]);
+        }
+        peak = std::max({top, peak - peak_fall, quiet});
+        for (size_t b = 0; b < shown.size(); b++) {
+            float level = float(std::clamp((db[b] - (peak - range)) / range * 8, 0.0, 8.0));
+            shown[b] = std::max(level, shown[b] - float(fall));
+        }
+        return shown;
+    }
+};
+
+///////////////////////////////////////////////////////////
+// what the levels look like
+enum Mode { COLUMNS, BARS, PULSE };
+
+static void paint(Frame &f, Mode mode, const std::vector<float> &level)
+{
+    if (mode == COLUMNS) {
+        f.fill(0);
+        for (unsigned b = 0; b < 64; b++) {     // low bands at the front
+            unsigned x = b % 8, y = b / 8, h = unsigned(level[b] + 0.5f);
+            for (unsigned z = 0; z < h; z++)
+                f[(7 - z) * 8 + y] |= 1 << x;  // up from the floor, z=7
+        }
+    }
+    else if (mode == BARS) {
+        for (unsigned z = 0; z < 8; z++)        // history moves back one row
+            for (unsigned y = 7; y > 0; y--)
+                f[z * 8 + y] = f[z * 8 + y - 1];
+        for (unsigned z = 0; z < 8; z++)
+            f[z * 8] = 0;
+        for (unsigned x = 0; x < 8; x++)
+            for (unsigned z = 0; z < unsigned(level[x] + 0.5f); z++)
+                f[(7 - z) * 8] |= 1 << x;
+    }
+    else {
+        float bass = (level[0] + level[1]) / 2;
+        double r = 0.5 + bass * 3.5 / 8;
+        f.fill(0);
+        for (unsigned z = 0; z < 8; z++)
+            for (unsigned y = 0; y < 8; y++)
+                for (unsigned x = 0; x < 8; x++) {
+                    double d = std::sqrt((x - 3.5) * (x - 3.5) + (y - 3.5) * (y - 3.5) + (z - 3.5) * (z - 3.5));
+                    if (std::fabs(d - r) < 0.6)
+                        f[z * 8 + y] |= 1 << x;
+                }
+    }
+}
+
+static const char usage[] =
+    "usage: cubeaudio [-m columns|bars|pulse] [-f fps] [-b bps] [-w window] [-r rate] [-C channels]\n"
+    "                 [-d range] [-x] [-o out] [-l log] [file.wav|-]\n";
+
+int main(int argc, char **argv)
+{
+    Mode mode = COLUMNS;
+    double fps = 0, bps = 9600, range = 36;
+    size_t window = 2048;
+    bool fast = false;
+    Input in;
+    std::string in_name = "-", out_name, log_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-m" && i + 1 < argc) {
+            std::string m = argv[++i];
+            if (m == "columns")
+                mode = COLUMNS;
+            else if (m == "bars")
+                mode = BARS;
+            else if (m == "pulse")
+                mode = PULSE;
+            else {
+                std::cerr << usage;
+                return 1;
+            }
+        }
+        else if (arg == "-f" && i + 1 < argc)
+            fps = std::atof(argv[++i]);
+        else if (arg == "-b" && i + 1 < argc)
+            bps = std::atof(argv[++i]);
+        else if (arg == "-w" && i + 1 < argc)
+            window = std::atoi(argv[++i]);
+        else if (arg == "-r" && i + 1 < argc)
+            in.rate = std::atoi(argv[++i]);
+        else if (arg == "-C" && i + 1 < argc)
+            in.channels = std::atoi(argv[++i]);
+        else if (arg == "-d" && i + 1 < argc)
+            range = std::atof(argv[++i]);
+        else if (arg == "-x")
+            fast = true;
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else if (arg == "-l" && i + 1 < argc)
+            log_name = argv[++i];
+        else if ((arg == "-" || arg[0] != '-') && i == argc - 1)
+            in_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (window < 64 || (window & (window - 1)) || bps <= 0 || range <= 0 || fps < 0 || !in.rate || !in.channels) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    bool from_stdin = in_name == "-";
+    in.file = from_stdin ? stdin : std::fopen(in_name.c_str(), "rb");
+    if (!in.file) {
+        std::cerr << "cannot read " << in_name << "\n";
+        return 1;
+    }
+    if (!in.open()) {
+        std::cerr << in_name << ": not a 16 bit PCM or 32 bit float WAV file\n";
+        return 1;
+    }
+    FILE *out = out_name.empty() ? stdout : std::fopen(out_name.c_str(), "wb");
+    FILE *log = log_name.empty() ? nullptr : std::fopen(log_name.c_str(), "w");
+    if (!out || (!log_name.empty() && !log)) {
+        std::cerr << "cannot write " << (out ? log_name : out_name) << "\n";
+        return 1;
+    }
+
+    // a full frame packet is ~70 bytes and frames go out on hop boundaries:
+    // a frame period of one packet plus one hop never queues a frame behind
+    // the one before it
+    size_t hop = window / 2;
+    double hop_time = double(hop) / in.rate;
+    double line_fps = 1 / (70 * 10 / bps + hop_time);
+    if (fps == 0)
+        fps = std::min(25.0, line_fps);
+    else if (fps > line_fps)
+        std::fprintf(stderr, "warning: %.1f fps is more than %.0f bps carries, frames will queue up\n", fps, bps);
+    double period = 1 / fps;
+    Analyser an(window, in.rate, mode == COLUMNS ? 64 : 8, range, 1 / hop_time);
+    std::fprintf(stderr, "%u Hz, %zu sample window, %zu sample hop, %.2f fps, window delay %.1f ms\n",
+                 in.rate, window, hop, fps, window / 2.0 / in.rate * 1e3);
+
+    std::vector<float> samples(window, 0.0f);   // the window, newest at the end
+    std::vector<unsigned char> stream;
+    std::vector<float> held(mode == COLUMNS ? 64 : 8, 0.0f);
+    Frame f{};
+    double byte_time = 10 / bps, next = period;
+    double line = 0, start = now_s();
+    unsigned long frames = 0;
+    std::vector<double> latency;
+    size_t bytes = 0;
+    for (unsigned long n = 0;; n++) {
+        // a file plays at its own rate, stdin arrives at it
+        if (!fast && !from_stdin) {
+            double due = start + (n + 1) * hop_time;
+            double wait = due - now_s();
+            if (wait > 0)
+                std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+        }
+        std::copy(samples.begin() + hop, samples.end(), samples.begin());
+        if (in.read(&samples[window - hop], hop) < hop)
+            break;
+        double t_in = now_s();
+
+        const std::vector<float> &level = an.levels(samples.data());
+        for (size_t b = 0; b < held.size(); b++)
+            held[b] = std::max(held[b], level[b]);
+        if ((n + 1) * hop_time < next)
+            continue;
+        next += period;
+        frames++;
+        paint(f, mode, held);
+        std::fill(held.begin(), held.end(), 0.0f);
+        stream.clear();
+        frame_packet(stream, f);
+        std::fwrite(stream.data(), 1, stream.size(), out);
+        std::fflush(out);
+        bytes += stream.size();
+
+        // the packet leaves the line after what is still queued before it
+        double t_out = now_s();
+        line = std::max(line, t_out) + stream.size() * byte_time;
+        latency.push_back(line - t_in);
+        if (log)
+            std::fprintf(log, "%.0f %.0f %lu\n", t_in * 1e6, line * 1e6, frames);
+    }
+    if (log)
+        std::fclose(log);
+    if (out != stdout)
+        std::fclose(out);
+
+    std::fprintf(stderr, "%lu frames, %zu bytes (%.1f per frame)\n", frames, bytes,
+                 frames ? double(bytes) / frames : 0.0);
+    if (fast || frames == 0)
+        return 0;                       // not real time, the latency means nothing
+    std::sort(latency.begin(), latency.end());
+    double mean = 0;
+    for (double l : latency)
+        mean += l;
+    mean /= frames;
+    size_t over = latency.end() - std::upper_bound(latency.begin(), latency.end(), period);
+    std::fprintf(stderr, "audio to frame latency: mean %.1f ms, p99 %.1f ms, max %.1f ms, frame period %.1f ms, "
+                 "%zu frames over one period\n", mean * 1e3, latency[frames * 99 / 100] * 1e3,
+                 latency.back() * 1e3, period * 1e3, over);
+    return 0;
+}
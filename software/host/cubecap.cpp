@@ -0,0 +1,141 @@
+// cubecap - records every byte host tools write to the cube: opens a pseudo
+// terminal for the host side (the printed /dev/pts/N or the -L link), passes
+// the bytes on to the real port (or to cubeemu) and writes them to a capture
+// log (cubecap.h) with the CLOCK_MONOTONIC time they were read in ns. Bytes
+// the cube sends back are passed to the host, not logged. cubereplay plays a
+// log back with its timing.
+//
+// usage: cubecap [-b bps] [-L link] -o log [port]
+//
+//   -b bps    line rate, set on a tty port and stored in the log (default 9600)
+//   -L link   symlink to the pty, e.g. /tmp/cubecap
+//   -o log    capture log
+//   port      serial device or pty (e.g. the cubeemu link) the bytes go on
+//             to, without it they are only logged
+//
+// Stops on SIGINT/SIGTERM. A write of the host is read as one chunk when the
+// port keeps up; bytes that queue up while the port blocks come as one later
+// chunk, with the time they were read.
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <string>
+#include <unistd.h>
+
+#include "cubecap.h"
+#include "serial.h"
+
+static const char usage[] = "usage: cubecap [-b bps] [-L link] -o log [port]\n";
+
+int main(int argc, char **argv)
+{
+    unsigned bps = 9600;
+    std::string link, log_name, port_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-b" && i + 1 < argc)
+            bps = std::atoi(argv[++i]);
+        else if (arg == "-L" && i + 1 < argc)
+            link = argv[++i];
+        else if (arg == "-o" && i + 1 < argc)
+            log_name = argv[++i];
+        else if (arg[0] != '-' && port_name.empty())
+            port_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (log_name.empty() || bps_speed(bps) == B0) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    int port = -1;
+    if (!port_name.empty()) {
+        port = open(port_name.c_str(), O_RDWR | O_NOCTTY);
+        if (port < 0) {
+            std::cerr << "cannot open " << port_name << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+        make_raw(port, bps);
+    }
+    // the slave end stays open here too, so the master does not read EIO
+    // between host runs
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        std::cerr << "cannot open a pty: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    std::string slave_name = ptsname(master);
+    int slave = open(slave_name.c_str(), O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        std::cerr << "cannot open " << slave_name << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    make_raw(slave, bps);
+    if (!link.empty()) {
+        unlink(link.c_str());
+        if (symlink(slave_name.c_str(), link.c_str()) != 0) {
+            std::cerr << "cannot link " << link << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+    }
+    FILE *log = std::fopen(log_name.c_str(), "wb");
+    if (!log) {
+        std::cerr << "cannot write " << log_name << "\n";
+        return 1;
+    }
+    CapWriter cap(log);
+    uint64_t start = clock_ns(CLOCK_MONOTONIC);
+    cap.header(bps, clock_ns(CLOCK_REALTIME));
+    std::fprintf(stderr, "capturing %s -> %s, %u bps\n", slave_name.c_str(),
+                 port_name.empty() ? "(log only)" : port_name.c_str(), bps);
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    unsigned long bytes = 0, chunks = 0;
+    uint64_t first = 0, last = 0;
+    while (!stop) {
+        pollfd pfd[2] = {{master, POLLIN, 0}, {port, POLLIN, 0}};
+        if (poll(pfd, port < 0 ? 1 : 2, 100) <= 0)
+            continue;
+        unsigned char buf[4096];
+        if (pfd[0].revents & POLLIN) {
+            ssize_t n = read(master, buf, sizeof buf);
+            if (n > 0) {
+                uint64_t t = clock_ns(CLOCK_MONOTONIC) - start;
+                cap.record(t, buf, n);
+                std::fflush(log);       // the log is whole up to a crash
+                if (!chunks)
+                    first = t;
+                last = t;
+                bytes += n;
+                chunks++;
+                if (port >= 0 && !write_all(port, buf, n)) {
+                    std::cerr << "cannot write " << port_name << ": " << std::strerror(errno) << "\n";
+                    break;
+                }
+            }
+        }
+        if (port >= 0 && (pfd[1].revents & POLLIN)) {  // the cube's TX back to the host
+            ssize_t n = read(port, buf, sizeof buf);
+            if (n > 0)
+                write_all(master, buf, n);
+        }
+    }
+    std::fclose(log);
+    if (!link.empty())
+        unlink(link.c_str());
+    std::fprintf(stderr, "%lu bytes in %lu writes over %.3f s\n", bytes, chunks, (last - first) * 1e-9);
+    return 0;
+}
@@ -0,0 +1,121 @@
+// cubecap.h - the capture log of cubecap and cubereplay: every chunk of
+// bytes the host wrote to the cube's serial port with its time in ns.
+//
+//   log    := "CUBECAP1" bps:u32 start:u64 record...
+//   record := delta:varint count:varint byte*count
+//
+// bps is the line rate of the port, start the CLOCK_REALTIME of the capture
+// start in ns (for matching with other logs), delta the ns since the record
+// before (the first: since start), count the bytes of one host write. u32 and
+// u64 are little endian, varints 7 bits a byte, low bits first, top bit set
+// on all but the last byte. A byte written on its own costs 3-5 bytes.
+#ifndef CUBECAP_H
+#define CUBECAP_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct CapRecord {
+    uint64_t t = 0;                     // ns since the capture start
+    std::vector<unsigned char> bytes;
+};
+
+///////////////////////////////////////////////////////////
+struct CapWriter {
+    FILE *file;
+    uint64_t last = 0;
+
+    explicit CapWriter(FILE *file_) : file(file_) {}
+
+    void put(uint64_t v, unsigned bytes)
+    {
+        for (unsigned i = 0; i < bytes; i++)
+            std::fputc(int(v >> (8 * i) & 0xFF), file);
+    }
+
+    void varint(uint64_t v)
+    {
+        for (; v >= 0x80; v >>= 7)
+            std::fputc(int(v & 0x7F) | 0x80, file);
+        std::fputc(int(v), file);
+    }
+
+    void header(uint32_t bps, uint64_t start)
+    {
+        std::fwrite("CUBECAP1", 1, 8, file);
+        put(bps, 4);
+        put(start, 8);
+    }
+
+    void record(uint64_t t, const unsigned char *p, size_t n)
+    {
+        varint(t - last);
+        varint(n);
+        std::fwrite(p, 1, n, file);
+        last = t;
+    }
+};
+
+///////////////////////////////////////////////////////////
+struct CapReader {
+    FILE *file;
+    uint32_t bps = 0;
+    uint64_t start = 0, last = 0;
+
+    explicit CapReader(FILE *file_) : file(file_) {}
+
+    bool get(uint64_t &v, unsigned bytes)
+    {
+        v = 0;
+        for (unsigned i = 0; i < bytes; i++) {
+            int c = std::fgetc(file);
+            if (c == EOF)
+                return false;
+            v |= uint64_t(c) << (8 * i);
+        }
+        return true;
+    }
+
+    bool varint(uint64_t &v)
+    {
+        v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            int c = std::fgetc(file);
+            if (c == EOF)
+                return false;
+            v |= uint64_t(c & 0x7F) << shift;
+            if (!(c & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    bool header()
+    {
+        char magic[8];
+        uint64_t b;
+        if (std::fread(magic, 1, 8, file) != 8 || std::memcmp(magic, "CUBECAP1", 8) || !get(b, 4) || !get(start, 8))
+            return false;
+        bps = uint32_t(b);
+        return true;
+    }
+
+    // false at the end of the log (or where a killed capture cut it off)
+    bool next(CapRecord &r)
+    {
+        uint64_t delta, n;
+        if (!varint(delta) || !varint(n) || n > (1u << 24))
+            return false;
+        r.bytes.resize(n);
+        if (std::fread(r.bytes.data(), 1, n, file) != n)
+            return false;
+        last += delta;
+        r.t = last;
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,231 @@
+// cubechain - drives cubes chained TX -> RX on one serial line as one larger
+// voxel volume: splits raw volume frames into addressed frame packets
+// (cubelink.h) and writes the stream, or runs it through simulated cubes.
+//
+// usage: cubechain [-c NXxNYxNZ] [-b bps] [-n frames] [-s] [-o out] [volume.raw]
+//
+//   -c NXxNYxNZ  cubes along x, y and z (default 2x1x1), cube
+//                c = (cz * NY + cy) * NX + cx has chain address c
+//   -b bps       line rate of the simulation (default 9600)
+//   -n frames    length of the test volume (default 100)
+//   -s           simulate the chain instead of writing the stream: every
+//                cube parses, runs and passes on the bytes like the v2
+//                firmware built with TX_ENABLED, the frames each cube shows
+//                and the aggregate frame rate go to stderr
+//   -o out       file or (configured) serial device for the stream,
+//                default stdout
+//
+// A volume frame is NX*NY*NZ*64 bytes in the layout of Volume::load().
+// Without a file a plane sweeping along x through all cubes is sent.
+// The stream starts with CMD_ENUM, which numbers the cubes in chain order.
+// In the simulation the cubes take no time for a byte, only the line does:
+// 10 bit times per byte on every hop.
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cubelink.h"
+
+// one byte on a line: time its stop bit is in, in seconds
+struct Byte {
+    double t;
+    unsigned char value;
+};
+
+///////////////////////////////////////////////////////////
+// a cube built with TX_ENABLED: the firmware receiver, its tx line and
+// the times its frames were shown
+struct Cube {
+    Receiver rx;
+    std::vector<double> shown;          // times frame packets ran
+    std::vector<Byte> out;              // bytes passed on out of TX
+    double now = 0;                     // time of the byte being received
+    double byte_time;
+    double tx_free = 0;                 // end of the byte being sent
+    size_t max_backlog = 0;
+
+    Cube(const Cube &) = delete;
+    explicit Cube(double byte_time_) : byte_time(byte_time_)
+    {
+        rx.run = [this](unsigned char cmd, const unsigned char *, unsigned len) {
+            if ((cmd == CMD_FRAME && len == 64) || cmd == CMD_MIRROR)
+                shown.push_back(now);
+        };
+        rx.pass = [this](unsigned char value) { send(value); };
+    }
+
+    void send(unsigned char value)
+    {
+        double start = now > tx_free ? now : tx_free;
+        // bytes waiting in the tx ring when this one is queued
+        size_t backlog = 0;
+        for (size_t i = out.size(); i-- > 0 && out[i].t > now;)
+            backlog++;
+        if (backlog > max_backlog)
+            max_backlog = backlog;
+        tx_free = start + byte_time;
+        out.push_back({tx_free, value});
+    }
+
+    void receive(const Byte &b)
+    {
+        now = b.t;
+        rx.receive(b.value);
+    }
+};
+
+///////////////////////////////////////////////////////////
+// run the stream through the chain and report what every cube showed
+static void simulate(const std::vector<unsigned char> &stream, const std::vector<size_t> &starts,
+                     unsigned cubes, double bps)
+{
+    double byte_time = 10.0 / bps;
+    std::vector<Byte> line;
+    for (size_t i = 0; i < stream.size(); i++)  // host sends back to back
+        line.push_back({(i + 1) * byte_time, stream[i]});
+
+    std::deque<Cube> chain;                     // the callbacks hold `this`
+    for (unsigned k = 0; k < cubes; k++)
+        chain.emplace_back(byte_time);
+    for (Cube &c : chain) {
+        for (const Byte &b : line)
+            c.receive(b);
+        line = c.out;                           // TX of this cube is RX of the next
+    }
+
+    // the enumeration as it comes out of the last cube
+    Receiver host;
+    unsigned counted = 0;
+    host.run = [&](unsigned char cmd, const unsigned char *p, unsigned len) {
+        if (cmd == CMD_ENUM && len == 1)
+            counted = p[0];
+    };
+    for (const Byte &b : line)
+        host.receive(b.value);
+
+    size_t volumes = starts.size();
+    double total = stream.size() * byte_time;
+    for (const Cube &c : chain)
+        if (!c.shown.empty() && c.shown.back() > total)
+            total = c.shown.back();
+    std::fprintf(stderr, "%u cubes, %.0f bps, %zu volume frames, %zu bytes (%.1f per cube frame)\n",
+                 cubes, bps, volumes, stream.size(),
+                 volumes ? double(stream.size()) / (volumes * cubes) : 0.0);
+    std::fprintf(stderr, "%-6s %7s %8s %10s %10s %8s\n",
+                 "cube", "frames", "fps", "first ms", "latency ms", "backlog");
+    double aggregate = 0, worst = 0;
+    for (unsigned k = 0; k < cubes; k++) {
+        const Cube &c = chain[k];
+        double fps = 0, latency = 0;
+        if (c.shown.size() > 1)
+            fps = (c.shown.size() - 1) / (c.shown.back() - c.shown.front());
+        // volume frame v is sent from byte starts[v] on
+        for (size_t v = 0; v < c.shown.size() && v < volumes; v++)
+            latency += c.shown[v] - starts[v] * byte_time;
+        if (!c.shown.empty())
+            latency /= c.shown.size();
+        aggregate += fps;
+        if (latency > worst)
+            worst = latency;
+        std::fprintf(stderr, "%-6u %7zu %8.2f %10.1f %10.1f %8zu\n", k, c.shown.size(), fps,
+                     c.shown.empty() ? 0.0 : c.shown.front() * 1e3, latency * 1e3, c.max_backlog);
+    }
+    std::fprintf(stderr, "aggregate %.2f cube frames/s, %.2f volume frames/s, worst mean latency %.1f ms\n",
+                 aggregate, aggregate / cubes, worst * 1e3);
+    std::fprintf(stderr, "enumeration returned %u cubes, last frame shown after %.2f s\n", counted, total);
+}
+
+static const char usage[] =
+    "usage: cubechain [-c NXxNYxNZ] [-b bps] [-n frames] [-s] [-o out] [volume.raw]\n";
+
+int main(int argc, char **argv)
+{
+    unsigned nx = 2, ny = 1, nz = 1, test_frames = 100;
+    double bps = 9600;
+    bool sim = false;
+    std::string in_name, out_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-c" && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%ux%ux%u", &nx, &ny, &nz) != 3) {
+                std::cerr << usage;
+                return 1;
+            }
+        }
+        else if (arg == "-b" && i + 1 < argc)
+            bps = std::atof(argv[++i]);
+        else if (arg == "-n" && i + 1 < argc)
+            test_frames = std::atoi(argv[++i]);
+        else if (arg == "-s")
+            sim = true;
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else if (arg[0] != '-' && in_name.empty())
+            in_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    unsigned cubes = nx * ny * nz;
+    if (cubes == 0 || cubes > 255 || bps <= 0) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    Volume vol(nx, ny, nz);
+    std::vector<unsigned char> stream;
+    std::vector<size_t> starts;     // stream offset of every volume frame
+    enumerate(stream);
+
+    if (!in_name.empty()) {
+        std::ifstream f(in_name, std::ios::binary);
+        if (!f) {
+            std::cerr << "cannot read " << in_name << "\n";
+            return 1;
+        }
+        std::vector<unsigned char> raw(vol.raw_size());
+        while (f.read(reinterpret_cast<char *>(raw.data()), raw.size())) {
+            vol.load(raw.data());
+            starts.push_back(stream.size());
+            vol.frames(stream);
+        }
+        if (f.gcount() != 0) {
+            std::cerr << in_name << ": size is not a multiple of " << raw.size() << " bytes\n";
+            return 1;
+        }
+    }
+    else {
+        for (unsigned n = 0; n < test_frames; n++) {
+            vol.clear();
+            unsigned x = n % vol.width();
+            for (unsigned z = 0; z < vol.height(); z++)
+                for (unsigned y = 0; y < vol.depth(); y++)
+                    vol.set(x, y, z, true);
+            starts.push_back(stream.size());
+            vol.frames(stream);
+        }
+    }
+
+    if (sim) {
+        simulate(stream, starts, cubes, bps);
+        return 0;
+    }
+    std::ofstream file;
+    if (!out_name.empty()) {
+        file.open(out_name, std::ios::binary);
+        if (!file) {
+            std::cerr << "cannot write " << out_name << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = out_name.empty() ? std::cout : file;
+    out.write(reinterpret_cast<const char *>(stream.data()), stream.size());
+    return 0;
+}
@@ -0,0 +1,211 @@
+// cubecodec - packs raw frame files (64 byte frames, as written by fx888,
+// cubevox or captured) into the seekable animation format of cubecodec.h,
+// unpacks them whole or from any frame, and compares with gzip.
+//
+// usage: cubecodec [-k key] [-c] in.raw out.cani      pack (default)
+//        cubecodec -d [-f first] [-n count] in.cani out.raw
+//        cubecodec -t [-k key] in.raw...                 sizes and speeds
+//
+//   -k key     frames a block, the most frames decoded to reach any frame
+//              (default 1024, 17 s at 61 fps)
+//   -d         unpack, from frame -f on (default 0), -n frames (default all)
+//   -t         for every file: raw, cubecodec and gzip -9 sizes, encode and
+//              decode speed (decoded twice, checked against the input) and
+//              the time to seek to random frames
+//
+// Sizes and speeds go to stderr.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cubecodec.h"
+
+static bool read_file(const std::string &name, std::vector<unsigned char> &data)
+{
+    std::ifstream f(name, std::ios::binary);
+    if (!f)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool write_file(const std::string &name, const unsigned char *p, size_t n)
+{
+    std::ofstream f(name, std::ios::binary);
+    return f.write(reinterpret_cast<const char *>(p), n).good();
+}
+
+static bool read_frames(const std::string &name, std::vector<Frame> &frames)
+{
+    std::vector<unsigned char> data;
+    if (!read_file(name, data)) {
+        std::cerr << "cannot read " << name << "\n";
+        return false;
+    }
+    if (data.size() % 64) {
+        std::cerr << name << ": size is not a multiple of 64 bytes\n";
+        return false;
+    }
+    frames.resize(data.size() / 64);
+    for (size_t n = 0; n < frames.size(); n++)
+        std::copy(&data[n * 64], &data[n * 64] + 64, frames[n].begin());
+    return true;
+}
+
+// bytes gzip -9 makes of a file, 0 without gzip
+static size_t gzip_size(const std::string &name)
+{
+    std::string cmd = "gzip -9 -c '" + name + "' 2>/dev/null";
+    FILE *p = popen(cmd.c_str(), "r");
+    if (!p)
+        return 0;
+    size_t n = 0;
+    char buf[65536];
+    for (size_t r; (r = std::fread(buf, 1, sizeof buf, p)) > 0;)
+        n += r;
+    return pclose(p) == 0 ? n : 0;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static int test(const std::vector<std::string> &names, unsigned key)
+{
+    std::fprintf(stderr, "%-16s %8s %9s %9s %7s %7s %9s %9s %8s\n", "file", "frames", "raw", "cubecodec", "gzip -9",
+                 "ratio", "enc MB/s", "dec fr/s", "seek us");
+    size_t total_raw = 0, total_codec = 0, total_gzip = 0;
+    for (const std::string &name : names) {
+        std::vector<Frame> frames;
+        if (!read_frames(name, frames))
+            return 1;
+        auto t0 = std::chrono::steady_clock::now();
+        std::vector<unsigned char> packed = anim_encode(frames, key);
+        double enc = seconds_since(t0);
+
+        AnimReader r;
+        r.open(packed.data(), packed.size());
+        std::vector<Frame> back;
+        double dec = 1e30;
+        for (int k = 0; k < 2; k++) {       // the better of two runs
+            back.clear();
+            back.reserve(frames.size());
+            t0 = std::chrono::steady_clock::now();
+            r.decode(0, r.frames, back);
+            dec = std::min(dec, seconds_since(t0));
+        }
+        if (back != frames) {
+            std::cerr << name << ": decoded frames differ\n";
+            return 1;
+        }
+        // single frames at random places
+        std::mt19937 rng(1);
+        double seek = 0;
+        const int seeks = 200;
+        for (int k = 0; k < seeks && !frames.empty(); k++) {
+            uint32_t n = rng() % frames.size();
+            back.clear();
+            t0 = std::chrono::steady_clock::now();
+            r.decode(n, 1, back);
+            seek += seconds_since(t0);
+            if (back[0] != frames[n]) {
+                std::cerr << name << ": frame " << n << " differs after a seek\n";
+                return 1;
+            }
+        }
+        size_t raw = frames.size() * 64, gz = gzip_size(name);
+        total_raw += raw;
+        total_codec += packed.size();
+        total_gzip += gz;
+        std::string base = name.substr(name.find_last_of('/') + 1);
+        std::fprintf(stderr, "%-16s %8zu %9zu %9zu %7zu %6.1fx %9.1f %9.0f %8.1f\n", base.c_str(), frames.size(), raw,
+                     packed.size(), gz, double(raw) / packed.size(), raw / enc / 1e6, frames.size() / dec,
+                     seek / seeks * 1e6);
+    }
+    std::fprintf(stderr, "total %zu raw, %zu cubecodec (%.1fx), %zu gzip -9 (%.1fx)\n", total_raw, total_codec,
+                 double(total_raw) / total_codec, total_gzip, total_gzip ? double(total_raw) / total_gzip : 0.0);
+    return 0;
+}
+
+static const char usage[] =
+    "usage: cubecodec [-k key] [-c] in.raw out.cani\n"
+    "       cubecodec -d [-f first] [-n count] in.cani out.raw\n"
+    "       cubecodec -t [-k key] in.raw...\n";
+
+int main(int argc, char **argv)
+{
+    unsigned key = 1024;
+    long first = 0, count = -1;
+    char mode = 'c';
+    std::vector<std::string> names;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-k" && i + 1 < argc)
+            key = std::atoi(argv[++i]);
+        else if (arg == "-f" && i + 1 < argc)
+            first = std::atol(argv[++i]);
+        else if (arg == "-n" && i + 1 < argc)
+            count = std::atol(argv[++i]);
+        else if (arg == "-c" || arg == "-d" || arg == "-t")
+            mode = arg[1];
+        else if (arg[0] != '-')
+            names.push_back(arg);
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (key == 0 || first < 0 || names.empty() || (mode != 't' && names.size() != 2)) {
+        std::cerr << usage;
+        return 1;
+    }
+    if (mode == 't')
+        return test(names, key);
+
+    if (mode == 'c') {
+        std::vector<Frame> frames;
+        if (!read_frames(names[0], frames))
+            return 1;
+        std::vector<unsigned char> packed = anim_encode(frames, key);
+        if (!write_file(names[1], packed.data(), packed.size())) {
+            std::cerr << "cannot write " << names[1] << "\n";
+            return 1;
+        }
+        std::fprintf(stderr, "%zu frames, %zu -> %zu bytes (%.1fx)\n", frames.size(), frames.size() * 64,
+                     packed.size(), packed.empty() ? 0.0 : frames.size() * 64.0 / packed.size());
+        return 0;
+    }
+
+    std::vector<unsigned char> data;
+    if (!read_file(names[0], data)) {
+        std::cerr << "cannot read " << names[0] << "\n";
+        return 1;
+    }
+    AnimReader r;
+    if (!r.open(data.data(), data.size())) {
+        std::cerr << names[0] << ": not a cubecodec file\n";
+        return 1;
+    }
+    std::vector<Frame> frames;
+    if (!r.decode(uint32_t(first), count < 0 ? r.frames : uint32_t(count), frames)) {
+        std::cerr << names[0] << ": corrupt, decoding failed at frame " << first + long(frames.size()) << "\n";
+        return 1;
+    }
+    std::vector<unsigned char> raw;
+    for (const Frame &f : frames)
+        raw.insert(raw.end(), f.begin(), f.end());
+    if (!write_file(names[1], raw.data(), raw.size())) {
+        std::cerr << "cannot write " << names[1] << "\n";
+        return 1;
+    }
+    return 0;
+}
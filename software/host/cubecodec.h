@@ -0,0 +1,425 @@
+// cubecodec.h - lossless codec for long 64 byte frame sequences (raw frame
+// files as written by fx888, cubevox, captures), with random access.
+//
+//   file  := "CUBEANI1" frames:u32 key:u32 blocks:u32 offset:u64*blocks block...
+//   block := range coded frames key*b .. key*b+key-1
+//
+// offsets count from the start of the file, u32/u64 are little endian.
+// Effects loop, so a frame is first tried against the frames before it in
+// its block:
+//   same       - the frame before again (a held frame)
+//   predicted  - the frame that followed the last match, a replayed sequence
+//   copy       - an earlier frame of the block, coded as its distance back
+// and otherwise coded as its XOR with the frame before (the first frame of
+// a block against an empty cube), or with the frame before moved one voxel
+// along x, y or z when that changes fewer rows (rain, scrolling text): the
+// move, which layers changed, which rows of those, and for every changed
+// row either the move of the frame before it is a row of (a row moving its
+// own way) or its byte. Every decision is a binary adaptive range coder
+// bit (LZMA style, 11 bit probabilities) with the same decision of the frame
+// before (for "same": the frames held so far) as its context. The models
+// and the history start over at every block, which makes a block decodable
+// on its own: seeking to frame n decodes at most key - 1 frames before it.
+#ifndef CUBECODEC_H
+#define CUBECODEC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "cubelink.h"
+
+///////////////////////////////////////////////////////////
+// adaptive binary range coder
+struct RangeEncoder {
+    std::vector<unsigned char> &out;
+    uint64_t low = 0;
+    uint32_t range = 0xFFFFFFFF;
+    unsigned char cache = 0;
+    uint64_t pending = 1;
+
+    explicit RangeEncoder(std::vector<unsigned char> &out_) : out(out_) {}
+
+    void shift()
+    {
+        if (uint32_t(low) < 0xFF000000u || (low >> 32)) {
+            unsigned char carry = (unsigned char)(low >> 32), b = cache;
+            do {
+                out.push_back((unsigned char)(b + carry));
+                b = 0xFF;
+            } while (--pending);
+            cache = (unsigned char)(low >> 24);
+        }
+        pending++;
+        low = (low & 0x00FFFFFF) << 8;
+    }
+
+    void bit(uint16_t &p, unsigned b)
+    {
+        uint32_t bound = (range >> 11) * p;
+        if (!b) {
+            range = bound;
+            p += (2048 - p) >> 5;
+        }
+        else {
+            low += bound;
+            range -= bound;
+            p -= p >> 5;
+        }
+        while (range < (1u << 24)) {
+            range <<= 8;
+            shift();
+        }
+    }
+
+    void flush()
+    {
+        for (int i = 0; i < 5; i++)
+            shift();
+    }
+};
+
+struct RangeDecoder {
+    const unsigned char *p, *end;
+    uint32_t range = 0xFFFFFFFF, code = 0;
+
+    RangeDecoder(const unsigned char *p_, const unsigned char *end_) : p(p_), end(end_)
+    {
+        for (int i = 0; i < 5; i++)
+            code = (code << 8) | next();
+    }
+
+    unsigned char next()
+    {
+        return p < end ? *p++ : 0;
+    }
+
+    unsigned bit(uint16_t &prob)
+    {
+        uint32_t bound = (range >> 11) * prob;
+        unsigned b;
+        if (code < bound) {
+            range = bound;
+            prob += (2048 - prob) >> 5;
+            b = 0;
+        }
+        else {
+            code -= bound;
+            range -= bound;
+            prob -= prob >> 5;
+            b = 1;
+        }
+        while (range < (1u << 24)) {
+            range <<= 8;
+            code = (code << 8) | next();
+        }
+        return b;
+    }
+};
+
+///////////////////////////////////////////////////////////
+// the probabilities of one block, encoder and decoder keep them in step
+struct FrameModel {
+    uint16_t same[8];                   // [frames held so far, up to 7]
+    uint16_t layer[8][2];               // [z][layer changed in the frame before]
+    uint16_t row[8][8][2];              // [z][y][row changed in the frame before]
+    uint16_t bits[2][256];              // bit tree of a changed byte [row was dark]
+    uint16_t predicted[2];              // [frame before was matched]
+    uint16_t copied[2];                 // [frame before was matched]
+    uint16_t length[32];                // bit tree of the bit length of a copy distance
+    uint16_t low[32];                   // distance bits below the top one [bit]
+    uint16_t moves[8];                  // bit tree of the move of the frame before
+    uint16_t row_moved[2];              // [reference row was dark]
+    uint16_t row_moves[8];              // bit tree of the move of a row
+    Frame prev{}, delta{};              // frame and XOR of the frame before
+    unsigned held = 0;                  // frames the same in a row before this one
+    bool was_match = false;
+    std::vector<Frame> history;         // the frames of the block so far
+    std::unordered_map<uint64_t, uint32_t> last_seen;  // frame hash -> newest index
+    long match = -1;                    // history index the frame before matched
+
+    FrameModel()
+    {
+        std::fill_n(same, 8, 1024);     // p = 0.5 everywhere
+        std::fill_n(&layer[0][0], 8 * 2, 1024);
+        std::fill_n(&row[0][0][0], 8 * 8 * 2, 1024);
+        std::fill_n(&bits[0][0], 2 * 256, 1024);
+        std::fill_n(predicted, 2, 1024);
+        std::fill_n(copied, 2, 1024);
+        std::fill_n(length, 32, 1024);
+        std::fill_n(low, 32, 1024);
+        std::fill_n(moves, 8, 1024);
+        std::fill_n(row_moved, 2, 1024);
+        std::fill_n(row_moves, 8, 1024);
+    }
+
+    // f moved one voxel: 0 - not, 1/2 - +-x, 3/4 - +-y, 5/6 - +-z
+    static Frame moved(const Frame &f, unsigned m)
+    {
+        Frame g{};
+        for (unsigned z = 0; z < 8; z++)
+            for (unsigned y = 0; y < 8; y++) {
+                unsigned i = z * 8 + y;
+                switch (m) {
+                case 0: g[i] = f[i]; break;
+                case 1: g[i] = (unsigned char)(f[i] << 1); break;
+                case 2: g[i] = f[i] >> 1; break;
+                case 3: g[i] = y ? f[i - 1] : 0; break;
+                case 4: g[i] = y < 7 ? f[i + 1] : 0; break;
+                case 5: g[i] = z ? f[i - 8] : 0; break;
+                case 6: g[i] = z < 7 ? f[i + 8] : 0; break;
+                }
+            }
+        return g;
+    }
+
+    static uint64_t hash(const Frame &f)
+    {
+        uint64_t h = 14695981039346656037ull;
+        for (unsigned char b : f)
+            h = (h ^ b) * 1099511628211ull;
+        return h;
+    }
+
+    // code f (Coder: RangeEncoder) or decode into f (RangeDecoder), the
+    // same walk through the decisions for both. false if the input decodes
+    // to a move or a copy that does not exist (a corrupt file)
+    template <class Coder, bool Decode>
+    bool code(Coder &rc, Frame &f)
+    {
+        long n = long(history.size()), copy = -1;
+        unsigned same_bit = Decode ? 0 : f == prev;
+        same_bit = step<Decode>(rc, same[held < 7 ? held : 7], same_bit);
+        held = same_bit ? held + 1 : 0;
+        if (same_bit)
+            f = prev;
+        else {
+            // the sequence the frame before matched goes on
+            bool can_predict = match >= 0 && match + 1 < n && history[match + 1] != prev;
+            unsigned hit = 0;
+            if (can_predict) {
+                hit = step<Decode>(rc, predicted[was_match], Decode ? 0 : f == history[match + 1]);
+                if (hit)
+                    f = history[match + 1];
+            }
+            if (!hit) {
+                if (!Decode) {
+                    auto it = last_seen.find(hash(f));
+                    if (it != last_seen.end() && history[it->second] == f)
+                        copy = it->second;
+                }
+                if (step<Decode>(rc, copied[was_match], copy >= 0)) {
+                    copy = n - long(code_distance<Decode>(rc, unsigned(n - copy)));
+                    if (copy < 0 || copy >= n)
+                        return false;
+                    f = history[copy];
+                }
+                else if (!code_delta<Coder, Decode>(rc, f))
+                    return false;
+            }
+        }
+        if (match >= 0 && match + 1 < n && history[match + 1] == f)
+            match++;
+        else
+            match = copy;
+        was_match = match >= 0;
+        for (unsigned i = 0; i < 64; i++)
+            delta[i] = f[i] ^ prev[i];
+        prev = f;
+        last_seen[hash(f)] = uint32_t(n);
+        history.push_back(f);
+        return true;
+    }
+
+    // distance back >= 2: its bit length on a tree, then the bits below the top one
+    template <bool Decode, class Coder>
+    unsigned code_distance(Coder &rc, unsigned d)
+    {
+        unsigned len = 0;
+        while (!Decode && (d >> len) > 1)
+            len++;
+        unsigned node = 1;
+        for (int k = 4; k >= 0; k--)
+            node = node * 2 + step<Decode>(rc, length[node], (len >> k) & 1);
+        len = node - 32;
+        unsigned v = 1;
+        for (int k = int(len) - 1; k >= 0; k--)
+            v = v * 2 + step<Decode>(rc, low[k], (d >> k) & 1);
+        return v;
+    }
+
+    // the XOR with the (moved) frame before: the move, changed layers, their
+    // changed rows, the bytes
+    template <class Coder, bool Decode>
+    bool code_delta(Coder &rc, Frame &f)
+    {
+        Frame d, ref, moves_of_prev[7];
+        for (unsigned m = 0; m < 7; m++)
+            moves_of_prev[m] = moved(prev, m);
+        unsigned move = 0;
+        if (!Decode) {
+            unsigned best = 65;
+            for (unsigned m = 0; m < 7; m++) {
+                unsigned rows = 0;
+                for (unsigned i = 0; i < 64; i++)
+                    rows += f[i] != moves_of_prev[m][i];
+                if (rows < best) {
+                    best = rows;
+                    move = m;
+                }
+            }
+            for (unsigned i = 0; i < 64; i++)
+                d[i] = f[i] ^ moves_of_prev[move][i];
+        }
+        unsigned node = 1;
+        for (int k = 2; k >= 0; k--)
+            node = node * 2 + step<Decode>(rc, moves[node], (move >> k) & 1);
+        move = node - 8;
+        if (move >= 7)
+            return false;
+        ref = moves_of_prev[move];
+        for (unsigned z = 0; z < 8; z++) {
+            bool before = false, now = false;
+            for (unsigned y = 0; y < 8; y++) {
+                before |= delta[z * 8 + y] != 0;
+                if (!Decode)
+                    now |= d[z * 8 + y] != 0;
+            }
+            now = step<Decode>(rc, layer[z][before], now);
+            for (unsigned y = 0; y < 8; y++) {
+                unsigned i = z * 8 + y;
+                unsigned changed = now ? step<Decode>(rc, row[z][y][delta[i] != 0], Decode ? 0 : d[i] != 0) : 0;
+                if (!changed) {
+                    d[i] = 0;
+                    continue;
+                }
+                unsigned row_move = 7;
+                for (unsigned m = 0; !Decode && m < 7 && row_move == 7; m++)
+                    if (moves_of_prev[m][i] == (ref[i] ^ d[i]))
+                        row_move = m;
+                if (step<Decode>(rc, row_moved[ref[i] == 0], row_move < 7)) {
+                    unsigned node = 1;
+                    for (int k = 2; k >= 0; k--)
+                        node = node * 2 + step<Decode>(rc, row_moves[node], (row_move >> k) & 1);
+                    if (node - 8 >= 7)
+                        return false;
+                    d[i] = ref[i] ^ moves_of_prev[node - 8][i];
+                    continue;
+                }
+                // a changed row is never 0, code it less one
+                uint16_t *tree = bits[ref[i] == 0];
+                unsigned v = Decode ? 0 : unsigned(d[i]) - 1, node = 1;
+                for (int k = 7; k >= 0; k--)
+                    node = node * 2 + step<Decode>(rc, tree[node], (v >> k) & 1);
+                d[i] = (unsigned char)(node - 256 + 1);
+            }
+        }
+        for (unsigned i = 0; i < 64; i++)
+            f[i] = ref[i] ^ d[i];
+        return true;
+    }
+
+  private:
+    template <bool Decode, class Coder>
+    static unsigned step(Coder &rc, uint16_t &p, unsigned b)
+    {
+        if constexpr (Decode)
+            return rc.bit(p);
+        else {
+            rc.bit(p, b);
+            return b;
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////
+inline void put_le(std::vector<unsigned char> &out, uint64_t v, unsigned bytes)
+{
+    for (unsigned i = 0; i < bytes; i++)
+        out.push_back((unsigned char)(v >> (8 * i)));
+}
+
+inline uint64_t get_le(const unsigned char *p, unsigned bytes)
+{
+    uint64_t v = 0;
+    for (unsigned i = 0; i < bytes; i++)
+        v |= uint64_t(p[i]) << (8 * i);
+    return v;
+}
+
+inline std::vector<unsigned char> anim_encode(const std::vector<Frame> &frames, unsigned key)
+{
+    size_t blocks = (frames.size() + key - 1) / key;
+    std::vector<unsigned char> out(8), body;
+    std::memcpy(out.data(), "CUBEANI1", 8);
+    put_le(out, frames.size(), 4);
+    put_le(out, key, 4);
+    put_le(out, blocks, 4);
+    size_t start = out.size() + 8 * blocks;
+    for (size_t b = 0; b < blocks; b++) {
+        put_le(out, start + body.size(), 8);
+        FrameModel model;
+        RangeEncoder rc(body);
+        for (size_t n = b * key; n < frames.size() && n < (b + 1) * key; n++) {
+            Frame f = frames[n];
+            model.code<RangeEncoder, false>(rc, f);
+        }
+        rc.flush();
+    }
+    out.insert(out.end(), body.begin(), body.end());
+    return out;
+}
+
+// random access reader of an encoded animation held in memory
+struct AnimReader {
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+    uint32_t frames = 0, key = 0, blocks = 0;
+
+    bool open(const unsigned char *p, size_t n)
+    {
+        if (n < 20 || std::memcmp(p, "CUBEANI1", 8))
+            return false;
+        data = p;
+        size = n;
+        frames = uint32_t(get_le(p + 8, 4));
+        key = uint32_t(get_le(p + 12, 4));
+        blocks = uint32_t(get_le(p + 16, 4));
+        if (!key || blocks != (uint64_t(frames) + key - 1) / key || 20 + 8ull * blocks > n)
+            return false;
+        for (uint32_t b = 0; b < blocks; b++)
+            if (offset(b) > n)
+                return false;
+        return true;
+    }
+
+    size_t offset(uint32_t b) const
+    {
+        return b < blocks ? size_t(get_le(data + 20 + 8 * b, 8)) : size;
+    }
+
+    // frames first .. first+count-1 appended to out. false if the data is
+    // corrupt, out then ends with the last frame before the damage
+    bool decode(uint32_t first, uint32_t count, std::vector<Frame> &out) const
+    {
+        uint64_t end = std::min(uint64_t(first) + count, uint64_t(frames));
+        for (uint64_t n = first; n < end;) {
+            uint32_t b = uint32_t(n / key);
+            FrameModel model;
+            RangeDecoder rc(data + offset(b), data + offset(b + 1));
+            Frame f;
+            for (uint64_t k = uint64_t(b) * key; k < end && k < (uint64_t(b) + 1) * key; k++) {
+                if (!model.code<RangeDecoder, true>(rc, f))
+                    return false;
+                if (k >= n)
+                    out.push_back(f);
+            }
+            n = (uint64_t(b) + 1) * key;
+        }
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,371 @@
+// cubeemu - emulates a v2 cube on a pseudo terminal: host tools open the
+// printed /dev/pts/N (or the -L link) as if it was the cube's serial port.
+// The bytes are taken off the line at the baud rate, go through the 128 byte
+// ring of uart_isr() (bytes that find it full are dropped, as the firmware
+// does) and are parsed by the receive() of the firmware (cubelink.h).
+// Applied frames are drawn in the terminal and/or written as PPM images and
+// logged with a timestamp, so host side latency and throughput can be
+// measured end to end.
+//
+// usage: cubeemu [-b bps] [-n ring] [-c us] [-f us] [-a addr] [-L link]
+//                [-t] [-p prefix] [-l log]
+//
+//   -b bps      line rate (default 9600), followed when the host sets
+//               another speed on the pty
+//   -n ring     rx ring size (default 128, MAX_BUFFER of the firmware)
+//   -c us       main loop time per received byte (default 30)
+//   -f us       time to show a frame, swap() with scan_times() and clear()
+//               (default 1000)
+//   -a addr     chain address of the cube (default 0, as after power up)
+//   -L link     symlink to the pty, e.g. /tmp/cube
+//   -t          draw the cube in the terminal, the 8 layers side by side
+//   -p prefix   write every applied frame to prefixNNNNNN.ppm
+//   -l log      log every applied frame, "-" for stdout:
+//               <CLOCK_MONOTONIC us> <frame> <kind> <bytes> <dropped> <fnv1a>
+//
+// The main loop times (-c, -f) are estimates, not measured on the MCU: the
+// ring only overflows when the main loop falls behind the line, which at
+// the default costs needs a stall such as CMD_SAVE (25 ms of IAP writes).
+// Emulated: legacy 0xF2 frames, CMD_FRAME, CMD_MIRROR, CMD_BRIGHT, CMD_SCAN,
+// CMD_ENUM, CMD_SAVE (timing only), CMD_STATS (as built with STATS, the reply
+// goes back on the pty; scan overruns are not modelled and stay 0). Other
+// commands are counted and logged.
+// The cube starts in serial mode, the flash_2() demo is not emulated.
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+
+#include "cubelink.h"
+#include "serial.h"
+
+///////////////////////////////////////////////////////////
+// what the cube shows: PPM images and terminal drawing
+static void write_ppm(const std::string &name, const Frame &f, unsigned bright)
+{
+    const unsigned cell = 6, side = 8 * cell, gap = cell;
+    const unsigned w = 8 * side + 7 * gap, h = side;
+    FILE *file = std::fopen(name.c_str(), "wb");
+    if (!file) {
+        std::fprintf(stderr, "cannot write %s\n", name.c_str());
+        return;
+    }
+    std::fprintf(file, "P6\n%u %u\n255\n", w, h);
+    unsigned char on = (unsigned char)(64 + 191 * bright / 15);
+    for (unsigned py = 0; py < h; py++)
+        for (unsigned px = 0; px < w; px++) {
+            unsigned z = px / (side + gap), lx = px % (side + gap);
+            unsigned char rgb[3] = {0, 0, 0};
+            if (lx < side) {
+                unsigned x = lx / cell, y = 7 - py / cell;  // y = 7 at the top
+                bool border = lx % cell == 0 || py % cell == 0;
+                if (!border && (f[z * 8 + y] >> x & 1))
+                    rgb[0] = on, rgb[1] = on / 4;
+                else if (!border)
+                    rgb[0] = rgb[1] = rgb[2] = 24;
+            }
+            std::fwrite(rgb, 1, 3, file);
+        }
+    std::fclose(file);
+}
+
+static void draw(const Frame &f, unsigned long shown, unsigned long dropped, unsigned bright)
+{
+    std::string s = "\x1b[H";
+    char line[128];
+    std::snprintf(line, sizeof line, "frame %lu  dropped %lu  brightness %u\x1b[K\n", shown, dropped, bright);
+    s += line;
+    for (unsigned z = 0; z < 8; z++) {
+        std::snprintf(line, sizeof line, "z%u        ", z);
+        s += line;
+    }
+    s += "\n";
+    for (int y = 7; y >= 0; y--) {
+        for (unsigned z = 0; z < 8; z++) {
+            for (unsigned x = 0; x < 8; x++)
+                s += (f[z * 8 + y] >> x & 1) ? '#' : '.';
+            s += "  ";
+        }
+        s += "\n";
+    }
+    std::fwrite(s.data(), 1, s.size(), stdout);
+    std::fflush(stdout);
+}
+
+///////////////////////////////////////////////////////////
+// the cube: rx ring of uart_isr() and the main loop reading it, both on a
+// virtual clock that follows the line (arrival times of the bytes)
+struct Cube {
+    Receiver rx;
+    size_t ring;
+    double byte_cost, frame_cost;
+    std::deque<std::pair<double, unsigned char>> queue;  // arrival, byte
+    double busy = 0;            // main loop busy until
+    double extra = 0;           // cost of what the current byte ran
+    double t = 0;               // time the current byte is read
+    unsigned long bytes = 0, dropped = 0, shown = 0, ignored = 0, packets = 0;
+    double start = 0;           // power up, for the refresh count
+    CubeStats zeroed;           // counters at the last CMD_STATS with STATS_ZERO
+    std::vector<unsigned char> tx;  // bytes the cube sends back
+    unsigned bright = 15, scan = 0;
+    Frame frame{};
+
+    bool terminal = false;
+    std::string ppm;
+    FILE *log = nullptr;
+
+    Cube(size_t ring_, double byte_cost_, double frame_cost_)
+        : ring(ring_), byte_cost(byte_cost_), frame_cost(frame_cost_)
+    {
+        rx.raw = [this](const Frame &f) { show(f, "raw"); };
+        rx.run = [this](unsigned char cmd, const unsigned char *p, unsigned len) { run(cmd, p, len); };
+    }
+    Cube(const Cube &) = delete;
+
+    void show(const Frame &f, const char *kind)
+    {
+        frame = f;
+        extra += frame_cost;
+        shown++;
+        double at = t + byte_cost + extra;  // after swap() returns
+        if (log) {
+            uint32_t h = 2166136261u;
+            for (unsigned char b : f)
+                h = (h ^ b) * 16777619u;
+            std::fprintf(log, "%.0f %lu %s %lu %lu %08x\n", at * 1e6, shown, kind, bytes, dropped, h);
+        }
+        if (!ppm.empty()) {
+            char num[16];
+            std::snprintf(num, sizeof num, "%06lu", shown);
+            write_ppm(ppm + num + ".ppm", f, bright);
+        }
+        if (terminal)
+            draw(f, shown, dropped, bright);
+    }
+
+    // the counters of the firmware built with STATS, as they wrap
+    CubeStats counters() const
+    {
+        CubeStats s;
+        s.address = rx.address;
+        s.rx = uint16_t(bytes - zeroed.rx);
+        s.dropped = uint16_t(dropped - zeroed.dropped);
+        s.refreshes = uint16_t((unsigned long)((t - start) / 0.016384) - zeroed.refreshes);
+        s.packets = uint16_t(packets - zeroed.packets);
+        s.bad = uint16_t(rx.bad - zeroed.bad);
+        s.frames = s.swaps = uint16_t(shown - zeroed.frames);
+        return s;
+    }
+
+    void run(unsigned char cmd, const unsigned char *p, unsigned len)
+    {
+        Frame f{};
+        packets++;
+        if (cmd == CMD_FRAME && len == 64) {
+            std::copy(p, p + 64, f.begin());
+            show(f, "frame");
+        }
+        else if (cmd == CMD_MIRROR && mirror_frame(f, p, len))
+            show(f, "mirror");
+        else if (cmd == CMD_BRIGHT && len == 1 && p[0] <= 15)
+            bright = p[0];
+        else if (cmd == CMD_SCAN && len == 1)
+            scan = p[0];
+        else if (cmd == CMD_SAVE)
+            extra += 0.025;             // erase + program of the settings sector
+        else if (cmd == CMD_STATS && len <= 1) {
+            unsigned char reply[CubeStats::LEN];
+            counters().payload(reply);
+            packet(tx, CMD_STATS_REPLY, reply, sizeof reply, ADDR_ALL);
+            if (len == 1 && (p[0] & STATS_ZERO)) {
+                zeroed.rx = uint16_t(bytes);
+                zeroed.dropped = uint16_t(dropped);
+                zeroed.refreshes = uint16_t((unsigned long)((t - start) / 0.016384));
+                zeroed.packets = uint16_t(packets);
+                zeroed.bad = uint16_t(rx.bad);
+                zeroed.frames = uint16_t(shown);
+            }
+        }
+        else if (cmd != CMD_ENUM) {
+            ignored++;
+            if (log)
+                std::fprintf(log, "# cmd 0x%02X len %u not emulated\n", cmd, len);
+        }
+    }
+
+    // let the main loop read every byte it gets to before `until`
+    void advance(double until)
+    {
+        while (!queue.empty()) {
+            double start = queue.front().first > busy ? queue.front().first : busy;
+            if (start > until)
+                break;
+            unsigned char value = queue.front().second;
+            queue.pop_front();          // recv_uart() frees the slot
+            t = start;
+            extra = 0;
+            rx.receive(value);
+            busy = start + byte_cost + extra;
+        }
+    }
+
+    // a byte whose stop bit is in at `at`
+    void arrive(double at, unsigned char value)
+    {
+        advance(at);
+        bytes++;
+        if (queue.size() >= ring)       // uart_isr() drops it
+            dropped++;
+        else
+            queue.push_back({at, value});
+    }
+};
+
+static const char usage[] =
+    "usage: cubeemu [-b bps] [-n ring] [-c us] [-f us] [-a addr] [-L link] [-t] [-p prefix] [-l log]\n";
+
+int main(int argc, char **argv)
+{
+    unsigned bps = 9600, ring = 128, addr = 0;
+    double byte_us = 30, frame_us = 1000;
+    bool terminal = false;
+    std::string link, ppm, log_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-b" && i + 1 < argc)
+            bps = std::atoi(argv[++i]);
+        else if (arg == "-n" && i + 1 < argc)
+            ring = std::atoi(argv[++i]);
+        else if (arg == "-c" && i + 1 < argc)
+            byte_us = std::atof(argv[++i]);
+        else if (arg == "-f" && i + 1 < argc)
+            frame_us = std::atof(argv[++i]);
+        else if (arg == "-a" && i + 1 < argc)
+            addr = std::atoi(argv[++i]);
+        else if (arg == "-L" && i + 1 < argc)
+            link = argv[++i];
+        else if (arg == "-t")
+            terminal = true;
+        else if (arg == "-p" && i + 1 < argc)
+            ppm = argv[++i];
+        else if (arg == "-l" && i + 1 < argc)
+            log_name = argv[++i];
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (bps_speed(bps) == B0 || ring == 0 || addr > 254 || byte_us < 0 || frame_us < 0) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    // the pty: the slave end stays open here too, so the master does not
+    // read EIO between host runs
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        std::cerr << "cannot open a pty: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    std::string slave_name = ptsname(master);
+    int slave = open(slave_name.c_str(), O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        std::cerr << "cannot open " << slave_name << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    make_raw(slave, bps);
+    if (!link.empty()) {
+        unlink(link.c_str());
+        if (symlink(slave_name.c_str(), link.c_str()) != 0) {
+            std::cerr << "cannot link " << link << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+    }
+
+    Cube cube(ring, byte_us * 1e-6, frame_us * 1e-6);
+    cube.start = now_s();
+    cube.rx.address = (unsigned char)addr;
+    cube.terminal = terminal;
+    cube.ppm = ppm;
+    if (log_name == "-")
+        cube.log = stdout;
+    else if (!log_name.empty() && !(cube.log = std::fopen(log_name.c_str(), "w"))) {
+        std::cerr << "cannot write " << log_name << "\n";
+        return 1;
+    }
+    if (terminal) {
+        std::fputs("\x1b[2J", stdout);
+        draw(cube.frame, 0, 0, cube.bright);
+    }
+    std::fprintf(stderr, "cube on %s, %u bps, %u byte ring\n", slave_name.c_str(), bps, ring);
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    double line = 0;            // stop bit time of the last byte on the line
+    double first = 0, last = 0;
+    while (!stop) {
+        double now = now_s();
+        // follow a speed the host sets on its end
+        termios tio;
+        if (tcgetattr(master, &tio) == 0) {
+            unsigned b = speed_bps(cfgetospeed(&tio));
+            if (b && b != bps) {
+                bps = b;
+                std::fprintf(stderr, "host set %u bps\n", bps);
+            }
+        }
+        double byte_time = 10.0 / bps;
+        if (line < now)
+            line = now;         // idle line, the next byte starts now
+
+        // take only the bytes the line has carried by now, the rest waits
+        // in the pty and the host's writes block as on a real port
+        size_t want = 1 + (size_t)((now - line) / byte_time);
+        unsigned char buf[256];
+        if (line > now + byte_time)
+            want = 0;
+        if (want > sizeof buf)
+            want = sizeof buf;
+        pollfd pfd = {master, POLLIN, 0};
+        int wait_ms = want ? 1 : (int)((line - now - byte_time) * 1e3) + 1;
+        if (poll(&pfd, 1, wait_ms) > 0 && want && (pfd.revents & POLLIN)) {
+            ssize_t n = read(master, buf, want);
+            for (ssize_t i = 0; i < n; i++) {
+                line += byte_time;
+                if (!cube.bytes)
+                    first = line;
+                last = line;
+                cube.arrive(line, buf[i]);
+            }
+            if (cube.log)
+                std::fflush(cube.log);
+        }
+        cube.advance(now_s());
+        if (!cube.tx.empty()) {         // the cube's TX back to the host
+            ssize_t n = write(master, cube.tx.data(), cube.tx.size());
+            if (n > 0)
+                cube.tx.erase(cube.tx.begin(), cube.tx.begin() + n);
+        }
+    }
+    cube.advance(1e30);
+
+    if (!link.empty())
+        unlink(link.c_str());
+    if (cube.log && cube.log != stdout)
+        std::fclose(cube.log);
+    std::fprintf(stderr, "%lu bytes in %.2f s, %lu dropped, %lu frames shown, %lu commands not emulated\n",
+                 cube.bytes, last - first, cube.dropped, cube.shown, cube.ignored);
+    return 0;
+}
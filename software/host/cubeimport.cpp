@@ -0,0 +1,366 @@
+// cubeimport - converts animations saved by the DotMatrixJava control program
+// (and raw frame files) into what the host tools and the firmware use. Equal
+// frames in a row collapse into one step with a hold time, equal frames
+// anywhere in the animation are stored once. Libraries of many files convert
+// in parallel, one file a thread.
+//
+// usage: cubeimport [-f raw|index|cani|cap] [-r fps] [-d ms] [-b bps] [-k key]
+//                   [-j threads] [-o dir] file...
+//
+//   -f format   raw   - 64 byte frames at -r fps, holds repeated (for cubepack,
+//                       cubepipe, cubecodec)
+//               index - the frames stored once and the steps, see below
+//               cani  - the raw frames packed by cubecodec.h (seekable)
+//               cap   - the frame packets (cubelink.h, 0x0B where symmetric)
+//                       at the time of their step, a cubecap log for
+//                       cubereplay (default raw)
+//   -r fps      frame rate of raw and cani output (default 61)
+//   -d ms       time a frame shows where the file gives none (default 100)
+//   -b bps      line rate stored in a cap log (default 9600)
+//   -k key      frames between seek points in cani output (default 1024)
+//   -j threads  files converted at once (default: all cores)
+//   -o dir      output directory (default .), every file keeps its name
+//               with the extension of the format
+//
+// Input, read by read_animation():
+//   binary      a raw frame file, 64 bytes a frame, 1/fps each
+//   text        the frames as 64 values each in the legacy frame layout
+//               (layer by layer, 8 rows a layer, bit x of a row = voxel x),
+//               whitespace, commas, ; and brackets between them, # and //
+//               comment to the end of the line:
+//                 0x3c, 60          a row byte, hex or decimal
+//                 00111100          8, 64 or 512 0/1 characters: rows, char
+//                                   i is bit i of its row
+//                 delay 250         the frames after it show 250 ms
+//
+// Index file, u32 little endian:
+//   index := "CUBEIDX1" frames:u32 steps:u32 frame*frames step*steps
+//   frame := 64 bytes in the legacy frame layout
+//   step  := frame:u32 us:u32     the frame shows for us
+//
+// Frames in, steps, distinct frames and the output size of every file go to
+// stderr, and the totals with the conversion rate.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "cubecap.h"
+#include "cubecodec.h"
+
+struct Options {
+    std::string format = "raw", dir = ".";
+    double fps = 61;
+    unsigned delay = 100, bps = 9600, key = 1024;
+};
+
+struct Step {
+    uint32_t frame;
+    double ms;
+};
+
+// the frames of an animation stored once, and the steps showing them
+struct Index {
+    std::vector<Frame> frames;
+    std::vector<Step> steps;
+
+    Index(const std::vector<Frame> &in, const std::vector<double> &ms)
+    {
+        std::unordered_map<uint64_t, std::vector<uint32_t>> seen;  // hash -> frames
+        for (size_t n = 0; n < in.size(); n++) {
+            if (!steps.empty() && frames[steps.back().frame] == in[n]) {
+                steps.back().ms += ms[n];   // a run: one step held longer
+                continue;
+            }
+            std::vector<uint32_t> &same = seen[FrameModel::hash(in[n])];
+            auto it = std::find_if(same.begin(), same.end(), [&](uint32_t k) { return frames[k] == in[n]; });
+            if (it == same.end()) {
+                same.push_back(uint32_t(frames.size()));
+                frames.push_back(in[n]);
+                it = same.end() - 1;
+            }
+            steps.push_back({*it, ms[n]});
+        }
+    }
+
+    std::vector<unsigned char> save() const
+    {
+        std::vector<unsigned char> out(8);
+        std::memcpy(out.data(), "CUBEIDX1", 8);
+        put_le(out, frames.size(), 4);
+        put_le(out, steps.size(), 4);
+        for (const Frame &f : frames)
+            out.insert(out.end(), f.begin(), f.end());
+        for (const Step &s : steps) {
+            put_le(out, s.frame, 4);
+            put_le(out, uint64_t(std::llround(s.ms * 1000)), 4);
+        }
+        return out;
+    }
+
+    // frames at fps, a step shows from the frame its start time rounds to;
+    // steps shorter than a frame may round away, counted in dropped
+    std::vector<Frame> expand(double fps, size_t &dropped) const
+    {
+        std::vector<Frame> out;
+        double t = 0;
+        for (const Step &s : steps) {
+            size_t from = size_t(std::llround(t * fps / 1000)), to = size_t(std::llround((t + s.ms) * fps / 1000));
+            if (from == to)
+                dropped++;
+            for (size_t n = from; n < to; n++)
+                out.push_back(frames[s.frame]);
+            t += s.ms;
+        }
+        return out;
+    }
+};
+
+struct Result {
+    std::string in, out, error;
+    size_t frames = 0, steps = 0, distinct = 0, bytes_in = 0, bytes_out = 0, dropped = 0;
+};
+
+///////////////////////////////////////////////////////////
+// one value of a text animation: the bytes it adds, false if it is none
+static bool parse_value(const std::string &tok, std::vector<unsigned char> &bytes)
+{
+    if ((tok.size() == 8 || tok.size() == 64 || tok.size() == 512) &&
+        tok.find_first_not_of("01") == std::string::npos) {
+        for (size_t i = 0; i < tok.size(); i += 8) {
+            unsigned char b = 0;
+            for (unsigned x = 0; x < 8; x++)
+                if (tok[i + x] == '1')
+                    b |= 1 << x;
+            bytes.push_back(b);
+        }
+        return true;
+    }
+    char *end;
+    unsigned long v = std::strtoul(tok.c_str(), &end, 0);
+    if (tok.empty() || *end || v > 255)
+        return false;
+    bytes.push_back((unsigned char)v);
+    return true;
+}
+
+// the frames of a file with the ms every one shows, false with error set
+static bool read_animation(const std::string &name, const Options &opt, std::vector<Frame> &frames,
+                           std::vector<double> &ms, size_t &size, std::string &error)
+{
+    std::ifstream f(name, std::ios::binary);
+    if (!f) {
+        error = "cannot read " + name;
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    size = data.size();
+
+    bool text = std::all_of(data.begin(), data.end(), [](char c) {
+        return (c >= ' ' && c < 0x7F) || c == '\n' || c == '\r' || c == '\t';
+    });
+    if (!text) {
+        if (data.size() % 64) {
+            error = name + ": not text and not a whole number of 64 byte frames";
+            return false;
+        }
+        for (size_t i = 0; i < data.size(); i += 64) {
+            Frame fr;
+            std::copy(data.begin() + i, data.begin() + i + 64, fr.begin());
+            frames.push_back(fr);
+            ms.push_back(1000 / opt.fps);
+        }
+        return true;
+    }
+
+    std::istringstream in(data);
+    std::string line;
+    std::vector<unsigned char> bytes;
+    unsigned delay = opt.delay;
+    for (int line_no = 1; std::getline(in, line); line_no++) {
+        size_t c = std::min(line.find('#'), line.find("//"));
+        if (c != std::string::npos)
+            line.erase(c);
+        for (char &ch : line)
+            if (ch == ',' || ch == ';' || ch == '{' || ch == '}' || ch == '[' || ch == ']' || ch == '(' ||
+                ch == ')' || ch == '\r' || ch == '\t')
+                ch = ' ';
+        std::istringstream words(line);
+        for (std::string tok; words >> tok;) {
+            if (tok == "delay") {
+                long d;
+                if (!(words >> d) || d < 0) {
+                    error = name + ":" + std::to_string(line_no) + ": delay needs the ms";
+                    return false;
+                }
+                delay = unsigned(d);
+            }
+            else if (!parse_value(tok, bytes)) {
+                error = name + ":" + std::to_string(line_no) + ": '" + tok + "' is not a row byte";
+                return false;
+            }
+            for (; bytes.size() >= 64; bytes.erase(bytes.begin(), bytes.begin() + 64)) {
+                Frame fr;
+                std::copy(bytes.begin(), bytes.begin() + 64, fr.begin());
+                frames.push_back(fr);
+                ms.push_back(delay);
+            }
+        }
+    }
+    if (!bytes.empty()) {
+        error = name + ": " + std::to_string(bytes.size()) + " bytes after the last whole frame";
+        return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////
+// output name: the input name without its directory and extension
+static std::string out_name(const std::string &in, const Options &opt)
+{
+    std::string base = in.substr(in.find_last_of('/') + 1);
+    size_t dot = base.find_last_of('.');
+    if (dot != std::string::npos && dot > 0)
+        base.erase(dot);
+    return opt.dir + "/" + base + "." + opt.format;
+}
+
+static void convert(Result &r, const Options &opt)
+{
+    std::vector<Frame> frames;
+    std::vector<double> ms;
+    if (!read_animation(r.in, opt, frames, ms, r.bytes_in, r.error))
+        return;
+    r.frames = frames.size();
+
+    Index index(frames, ms);
+    r.steps = index.steps.size();
+    r.distinct = index.frames.size();
+
+    r.out = out_name(r.in, opt);
+    FILE *f = std::fopen(r.out.c_str(), "wb");
+    if (!f) {
+        r.error = "cannot write " + r.out;
+        return;
+    }
+    std::vector<unsigned char> out;
+    if (opt.format == "cap") {
+        CapWriter cap(f);
+        cap.header(opt.bps, 0);         // no wall clock start
+        double t = 0;
+        for (const Step &s : index.steps) {
+            out.clear();
+            frame_packet(out, index.frames[s.frame]);
+            cap.record(uint64_t(std::llround(t * 1e6)), out.data(), out.size());
+            t += s.ms;
+        }
+        out.clear();
+    }
+    else if (opt.format == "index")
+        out = index.save();
+    else {
+        std::vector<Frame> raw = index.expand(opt.fps, r.dropped);
+        if (opt.format == "raw")
+            for (const Frame &fr : raw)
+                out.insert(out.end(), fr.begin(), fr.end());
+        else
+            out = anim_encode(raw, opt.key);
+    }
+    std::fwrite(out.data(), 1, out.size(), f);
+    bool ok = !std::ferror(f);
+    r.bytes_out = std::ftell(f);
+    if (std::fclose(f) != 0 || !ok)
+        r.error = "cannot write " + r.out;
+}
+static const char usage[] = "usage: cubeimport [-f raw|index|cani|cap] [-r fps] [-d ms] [-b bps] [-k key]\n"
+                            "                  [-j threads] [-o dir] file...\n";
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    unsigned threads = std::thread::hardware_concurrency();
+    std::vector<Result> results;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-f" && i + 1 < argc)
+            opt.format = argv[++i];
+        else if (arg == "-r" && i + 1 < argc)
+            opt.fps = std::atof(argv[++i]);
+        else if (arg == "-d" && i + 1 < argc)
+            opt.delay = std::atoi(argv[++i]);
+        else if (arg == "-b" && i + 1 < argc)
+            opt.bps = std::atoi(argv[++i]);
+        else if (arg == "-k" && i + 1 < argc)
+            opt.key = std::atoi(argv[++i]);
+        else if (arg == "-j" && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (arg == "-o" && i + 1 < argc)
+            opt.dir = argv[++i];
+        else if (arg[0] != '-') {
+            results.emplace_back();
+            results.back().in = arg;
+        }
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (results.empty() || opt.fps <= 0 || opt.key == 0 ||
+        (opt.format != "raw" && opt.format != "index" && opt.format != "cani" && opt.format != "cap")) {
+        std::cerr << usage;
+        return 1;
+    }
+    if (threads == 0)
+        threads = 1;
+
+    // every thread takes the next file not taken yet
+    std::atomic<size_t> next(0);
+    auto t0 = std::chrono::steady_clock::now();
+    auto work = [&] {
+        for (size_t n; (n = next++) < results.size();)
+            convert(results[n], opt);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned k = 1; k < threads && k < results.size(); k++)
+        pool.emplace_back(work);
+    work();
+    for (std::thread &th : pool)
+        th.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    int status = 0;
+    size_t frames = 0, bytes_in = 0, bytes_out = 0, done = 0;
+    for (const Result &r : results) {
+        if (!r.error.empty()) {
+            std::cerr << r.error << "\n";
+            status = 1;
+            continue;
+        }
+        std::fprintf(stderr, "%s: %zu frames, %zu steps, %zu distinct", r.out.c_str(), r.frames, r.steps,
+                     r.distinct);
+        if (r.dropped)
+            std::fprintf(stderr, ", %zu steps under a frame at %.0f fps dropped", r.dropped, opt.fps);
+        std::fprintf(stderr, ", %zu -> %zu bytes\n", r.bytes_in, r.bytes_out);
+        frames += r.frames;
+        bytes_in += r.bytes_in;
+        bytes_out += r.bytes_out;
+        done++;
+    }
+    std::fprintf(stderr, "%zu of %zu files, %zu frames, %zu -> %zu bytes in %.3f s (%.1f MB/s) on %u threads\n",
+                 done, results.size(), frames, bytes_in, bytes_out, secs, secs > 0 ? bytes_in / secs / 1e6 : 0.0,
+                 threads);
+    return status;
+}
@@ -0,0 +1,395 @@
+// cubelink.h - the v2 firmware serial protocol for the host tools: packets
+// (escaped, crc8 checked), addressed packets for cubes chained TX -> RX on
+// one serial line, and the split of a larger voxel volume into the 64 byte
+// frames of its cubes. See the "serial protocol" section of the firmware.
+#ifndef CUBELINK_H
+#define CUBELINK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+typedef std::array<unsigned char, 64> Frame;    // display[z][y], bit x = LED x
+
+static const unsigned char FRAME_START = 0xF2;  // legacy raw frame marker
+static const unsigned char PACKET_START = 0xF1;
+static const unsigned char PACKET_ESC = 0xF3;   // next byte is xor-ed with 0x20
+
+static const unsigned char CMD_FRAME = 0x01;
+static const unsigned char CMD_SCAN = 0x02;
+static const unsigned char CMD_BRIGHT = 0x03;
+static const unsigned char CMD_TRANSITION = 0x04;
+static const unsigned char CMD_LIFE = 0x05;
+static const unsigned char CMD_PARTICLES = 0x06;
+static const unsigned char CMD_TEXT = 0x07;
+static const unsigned char CMD_PLAY = 0x08;
+static const unsigned char CMD_SAVE = 0x09;
+static const unsigned char CMD_ENUM = 0x0A;
+static const unsigned char CMD_MIRROR = 0x0B;
+static const unsigned char CMD_STATS = 0x0C;        // firmware built with STATS (and TX_ENABLED)
+static const unsigned char CMD_STATS_REPLY = 0x0D;  // sent by the cube to ADDR_ALL
+static const unsigned char CMD_ADDRESSED = 0x80; // cmd flag: an address byte follows
+static const unsigned char ADDR_ALL = 0xFF;
+static const int NO_ADDR = -1;                   // packet for whichever cube reads it
+
+static const unsigned char MIRROR_X = 0x01;      // CMD_MIRROR axes
+static const unsigned char MIRROR_Y = 0x02;
+static const unsigned char MIRROR_Z = 0x04;
+
+static const unsigned char STATS_ZERO = 0x01;    // CMD_STATS flags: zero the counters after the reply
+
+///////////////////////////////////////////////////////////
+// crc8, polynomial 0x07, init 0
+inline unsigned char crc8(unsigned char crc, unsigned char value)
+{
+    crc ^= value;
+    for (int i = 0; i < 8; i++)
+        crc = (crc & 0x80) ? (unsigned char)((crc << 1) ^ 0x07) : (unsigned char)(crc << 1);
+    return crc;
+}
+
+///////////////////////////////////////////////////////////
+// append one byte of a packet body, escaped as the firmware expects
+inline void put_escaped(std::vector<unsigned char> &out, unsigned char value)
+{
+    if (value == PACKET_START || value == FRAME_START || value == PACKET_ESC) {
+        out.push_back(PACKET_ESC);
+        value ^= 0x20;
+    }
+    out.push_back(value);
+}
+
+///////////////////////////////////////////////////////////
+// append a packet, addr NO_ADDR, a cube address 0..254 or ADDR_ALL
+inline void packet(std::vector<unsigned char> &out, unsigned char cmd,
+                   const unsigned char *payload, size_t len, int addr = NO_ADDR)
+{
+    std::vector<unsigned char> body;
+    body.push_back(addr == NO_ADDR ? cmd : (unsigned char)(cmd | CMD_ADDRESSED));
+    if (addr != NO_ADDR)
+        body.push_back((unsigned char)addr);
+    body.push_back((unsigned char)len);
+    body.insert(body.end(), payload, payload + len);
+
+    unsigned char crc = 0;
+    out.push_back(PACKET_START);
+    for (unsigned char b : body) {
+        crc = crc8(crc, b);
+        put_escaped(out, b);
+    }
+    put_escaped(out, crc);
+}
+
+///////////////////////////////////////////////////////////
+inline unsigned char bit_reverse(unsigned char b)
+{
+    b = (unsigned char)((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+    b = (unsigned char)((b & 0xCC) >> 2 | (b & 0x33) << 2);
+    return (unsigned char)((b & 0xAA) >> 1 | (b & 0x55) << 1);
+}
+
+///////////////////////////////////////////////////////////
+// MIRROR_ axes along which the frame is its own mirror image (x -> 7 - x)
+inline unsigned symmetry(const Frame &f)
+{
+    unsigned axes = MIRROR_X | MIRROR_Y | MIRROR_Z;
+    for (unsigned z = 0; z < 8; z++)
+        for (unsigned y = 0; y < 8; y++) {
+            unsigned char r = f[z * 8 + y];
+            if (r != bit_reverse(r))
+                axes &= ~MIRROR_X;
+            if (r != f[z * 8 + 7 - y])
+                axes &= ~MIRROR_Y;
+            if (r != f[(7 - z) * 8 + y])
+                axes &= ~MIRROR_Z;
+        }
+    return axes;
+}
+
+///////////////////////////////////////////////////////////
+// append a frame as its smallest packet: CMD_MIRROR with the rows of the
+// low half, quadrant or octant if it is symmetric, else CMD_FRAME
+inline void frame_packet(std::vector<unsigned char> &out, const Frame &f, int addr = NO_ADDR)
+{
+    unsigned axes = symmetry(f);
+    if (!axes) {
+        packet(out, CMD_FRAME, f.data(), 64, addr);
+        return;
+    }
+    std::vector<unsigned char> p(1, (unsigned char)axes);
+    unsigned ny = (axes & MIRROR_Y) ? 4 : 8, nz = (axes & MIRROR_Z) ? 4 : 8, n = 0;
+    for (unsigned z = 0; z < nz; z++)
+        for (unsigned y = 0; y < ny; y++, n++) {
+            unsigned char r = f[z * 8 + y];
+            if (!(axes & MIRROR_X))
+                p.push_back(r);
+            else if (n & 1)             // two rows per byte, low nibble first
+                p.back() |= (unsigned char)((r & 0x0F) << 4);
+            else
+                p.push_back(r & 0x0F);
+        }
+    packet(out, CMD_MIRROR, p.data(), p.size(), addr);
+}
+
+///////////////////////////////////////////////////////////
+// expand a CMD_MIRROR payload (axes, rows) like mirror() of the firmware,
+// false if the length does not fit the axes
+inline bool mirror_frame(Frame &f, const unsigned char *p, size_t len)
+{
+    static const unsigned char sizes[8] = {64, 32, 32, 16, 32, 16, 16, 8};
+    if (len < 1 || p[0] > 7 || len != 1u + sizes[p[0]])
+        return false;
+    unsigned axes = p[0], ny = (axes & MIRROR_Y) ? 4 : 8, nz = (axes & MIRROR_Z) ? 4 : 8, n = 0;
+    for (unsigned z = 0; z < nz; z++)
+        for (unsigned y = 0; y < ny; y++, n++) {
+            unsigned char r;
+            if (axes & MIRROR_X) {
+                r = (n & 1) ? p[1 + n / 2] >> 4 : p[1 + n / 2] & 0x0F;
+                r = (unsigned char)(r | (bit_reverse(r) & 0xF0));
+            }
+            else
+                r = p[1 + n];
+            unsigned y2 = (axes & MIRROR_Y) ? 7 - y : y, z2 = (axes & MIRROR_Z) ? 7 - z : z;
+            f[z * 8 + y] = f[z * 8 + y2] = f[z2 * 8 + y] = f[z2 * 8 + y2] = r;
+        }
+    return true;
+}
+
+///////////////////////////////////////////////////////////
+// receive() of the firmware for host side cubes (emulator, simulated
+// chains): feed it the bytes of the line, it calls
+//   run(cmd, payload, len)  for packets that passed the crc and are for
+//                           this cube (cmd without CMD_ADDRESSED)
+//   raw(frame)              for legacy 0xF2 frames
+//   pass(byte)              if set, for every byte sent on out of TX, as
+//                           the firmware built with TX_ENABLED
+// Packets failing the crc are counted in bad (stat_crc of the firmware).
+// CMD_ENUM is handled here, run() sees it after the address is taken.
+struct Receiver {
+    unsigned char address = 0;          // cube_addr
+    bool legacy = true;                 // LEGACY_ENABLED
+    std::function<void(unsigned char, const unsigned char *, unsigned)> run;
+    std::function<void(const Frame &)> raw;
+    std::function<void(unsigned char)> pass;
+
+    enum { IDLE, RAW, CMD, LEN, DATA, CRC, ADDR };
+    int state = IDLE;
+    unsigned char cmd = 0, addr = 0, len = 0, pos = 0, crc = 0, tx_crc = 0;
+    bool escape = false, forward = false;
+    unsigned char payload[64];
+    Frame frame;                        // legacy frame being received
+    unsigned long bad = 0;              // packets with a bad crc
+
+    void receive(unsigned char value)
+    {
+        if (legacy && state == RAW) {
+            frame[pos] = value;
+            if (++pos >= 64) {
+                if (raw)
+                    raw(frame);
+                state = IDLE;
+            }
+            return;
+        }
+        if (value == FRAME_START) {     // inside a packet it only drops it
+            state = legacy && state == IDLE ? RAW : IDLE;
+            pos = 0;
+            return;
+        }
+        if (value == PACKET_START) {
+            state = CMD;
+            escape = forward = false;
+            return;
+        }
+        if (state == IDLE)
+            return;
+        if (value == PACKET_ESC) {
+            escape = true;
+            return;
+        }
+        if (escape) {
+            value ^= 0x20;
+            escape = false;
+            if (value < PACKET_START || value > PACKET_ESC) {
+                state = IDLE;           // only markers are escaped
+                return;
+            }
+        }
+        switch (state) {
+        case CMD:
+            cmd = value;
+            crc = crc8(0, value);
+            state = (value & CMD_ADDRESSED) ? ADDR : LEN;
+            break;
+        case ADDR:
+            addr = value;
+            crc = crc8(crc, value);
+            state = LEN;
+            if (pass && value != address) {
+                forward = true;
+                pass(PACKET_START);
+                tx_crc = 0;
+                send(cmd);
+                send(value);
+            }
+            break;
+        case LEN:
+            if (value > 64) {
+                state = IDLE;
+                break;
+            }
+            len = value;
+            pos = 0;
+            crc = crc8(crc, value);
+            state = value ? DATA : CRC;
+            if (forward)
+                send(value);
+            break;
+        case DATA:
+            payload[pos++] = value;
+            crc = crc8(crc, value);
+            if (pos >= len)
+                state = CRC;
+            if (forward)
+                send((pos == 1 && cmd == (CMD_ADDRESSED | CMD_ENUM)) ? (unsigned char)(value + 1) : value);
+            break;
+        case CRC:
+            if (value != crc)
+                bad++;
+            if (value == crc && (!(cmd & CMD_ADDRESSED) || addr == address || addr == ADDR_ALL)) {
+                unsigned char c = cmd & ~CMD_ADDRESSED;
+                if (c == CMD_ENUM && len == 1 && payload[0] != ADDR_ALL)
+                    address = payload[0];
+                if (run)
+                    run(c, payload, len);
+            }
+            if (forward)
+                send(value == crc ? tx_crc : (unsigned char)(tx_crc ^ 0xFF));
+            state = IDLE;
+            break;
+        }
+    }
+
+  private:
+    void send(unsigned char value)
+    {
+        tx_crc = crc8(tx_crc, value);
+        if (value == PACKET_START || value == FRAME_START || value == PACKET_ESC) {
+            pass(PACKET_ESC);
+            value ^= 0x20;
+        }
+        pass(value);
+    }
+};
+
+///////////////////////////////////////////////////////////
+// number the chain from the host side: the first cube takes first, every
+// cube passes the packet on with the address plus one, so what comes out
+// of the last cube (if its TX is wired back) carries first + cube count
+inline void enumerate(std::vector<unsigned char> &out, unsigned char first = 0)
+{
+    packet(out, CMD_ENUM, &first, 1, ADDR_ALL);
+}
+
+///////////////////////////////////////////////////////////
+// the counters of a CMD_STATS_REPLY, 16 bit and wrapping on the cube
+struct CubeStats {
+    unsigned char address = 0;
+    uint16_t rx = 0;            // bytes received
+    uint16_t dropped = 0;       // bytes lost, rx_buffer full
+    uint16_t overruns = 0;      // scan interrupts entered late
+    uint16_t refreshes = 0;     // full cube refreshes
+    uint16_t packets = 0;       // packets run
+    uint16_t bad = 0;           // packets with a bad crc
+    uint16_t frames = 0;        // host frames shown
+    uint16_t swaps = 0;         // frames shown from any source
+
+    static const unsigned LEN = 17;
+
+    // the reply payload, false if it is not one
+    bool parse(const unsigned char *p, unsigned len)
+    {
+        if (len != LEN)
+            return false;
+        uint16_t *counters[] = {&rx, &dropped, &overruns, &refreshes, &packets, &bad, &frames, &swaps};
+        address = p[0];
+        for (unsigned i = 0; i < 8; i++)
+            *counters[i] = uint16_t(p[1 + 2 * i] | p[2 + 2 * i] << 8);
+        return true;
+    }
+
+    void payload(unsigned char *p) const
+    {
+        const uint16_t counters[] = {rx, dropped, overruns, refreshes, packets, bad, frames, swaps};
+        p[0] = address;
+        for (unsigned i = 0; i < 8; i++) {
+            p[1 + 2 * i] = (unsigned char)counters[i];
+            p[2 + 2 * i] = (unsigned char)(counters[i] >> 8);
+        }
+    }
+};
+
+// ask for the counters: addr NO_ADDR for the first cube, ADDR_ALL for all
+inline void stats_query(std::vector<unsigned char> &out, int addr = ADDR_ALL, bool zero = false)
+{
+    unsigned char flags = zero ? STATS_ZERO : 0;
+    packet(out, CMD_STATS, &flags, 1, addr);
+}
+
+///////////////////////////////////////////////////////////
+// a voxel volume nx x ny x nz cubes large, stored as the cube frames side
+// by side: rows of 8 voxels along x, cube c = (cz * ny + cy) * nx + cx is
+// the cube with chain address c
+struct Volume {
+    unsigned nx, ny, nz;
+    std::vector<Frame> cubes;
+
+    Volume(unsigned nx_, unsigned ny_, unsigned nz_)
+        : nx(nx_), ny(ny_), nz(nz_), cubes(nx_ * ny_ * nz_, Frame{}) {}
+
+    unsigned width() const { return nx * 8; }
+    unsigned depth() const { return ny * 8; }
+    unsigned height() const { return nz * 8; }
+
+    // cube holding voxel x, y, z
+    size_t cube(unsigned x, unsigned y, unsigned z) const
+    {
+        return ((z / 8) * ny + y / 8) * nx + x / 8;
+    }
+
+    bool get(unsigned x, unsigned y, unsigned z) const
+    {
+        return (cubes[cube(x, y, z)][(z % 8) * 8 + y % 8] >> (x % 8)) & 1;
+    }
+
+    void set(unsigned x, unsigned y, unsigned z, bool on)
+    {
+        unsigned char &r = cubes[cube(x, y, z)][(z % 8) * 8 + y % 8];
+        r = on ? (unsigned char)(r | 1 << (x % 8)) : (unsigned char)(r & ~(1 << (x % 8)));
+    }
+
+    void clear() { cubes.assign(cubes.size(), Frame{}); }
+
+    // a raw volume frame: like the legacy frame but for the whole volume,
+    // rows of (z, y) from z = 0, y = 0, each row nx bytes, bit x % 8 of
+    // byte x / 8 = voxel x. load() splits it into the cube frames.
+    size_t raw_size() const { return cubes.size() * 64; }
+    void load(const unsigned char *raw)
+    {
+        for (unsigned z = 0; z < height(); z++)
+            for (unsigned y = 0; y < depth(); y++)
+                for (unsigned cx = 0; cx < nx; cx++)
+                    cubes[cube(cx * 8, y, z)][(z % 8) * 8 + y % 8] = *raw++;
+    }
+
+    // one addressed frame packet per cube, first + c is the address of cube c
+    void frames(std::vector<unsigned char> &out, unsigned char first = 0) const
+    {
+        for (size_t c = 0; c < cubes.size(); c++)
+            frame_packet(out, cubes[c], first + (int)c);
+    }
+};
+
+#endif
@@ -0,0 +1,337 @@
+// cubepack - packs raw frame streams (64 byte frames in the legacy serial
+// layout, as written by fx888) into the animation tables streamed by the
+// v2 firmware player (CMD_PLAY).
+//
+// usage: cubepack [-t keil|sdcc] [-r fps] [-p us] [-w window] [-n name] [-o out.h] file.raw...
+//
+//   -r fps      frame rate of the input streams (default 61)
+//   -p us       cube refresh period the holds are counted in (default 16384)
+//   -w window   history window of the decoder in bytes, 4..256 power of 2 (default 64)
+//   -n name     name of the emitted tables (default anim)
+//
+// Every input file becomes one animation. Equal frames in a row collapse
+// into one frame with a hold time, frames shorter than a refresh are dropped.
+// Stream format, decoded into the back buffer a few bytes at a time:
+//
+//   animation := frame... 0x00
+//   frame     := hold token...     hold 1..255 refreshes, tokens give 64 bytes
+//   token     := 0x00-0x3f         n+1 zero bytes
+//                0x40-0x7f b...    n+1 literal bytes
+//                0x80-0xff d       n-128+3 bytes copied from d+1 bytes back
+//
+// The decoded bytes are the XOR of the frame with the frame shown before it
+// (the first frame of an animation is XORed with an empty cube). Matches read
+// from the last `window` decoded bytes, which run on across frames.
+//
+// Sizes, compression ratios and decoder work per frame go to stderr.
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef std::array<unsigned char, 64> Frame;
+
+struct Shown {
+    Frame frame;
+    unsigned hold;                  // refreshes
+};
+
+static const unsigned MIN_MATCH = 3;
+
+///////////////////////////////////////////////////////////
+// collapse a fixed rate stream into frames with hold times
+static std::vector<Shown> timeline(const std::vector<Frame> &in, double fps, double period_us)
+{
+    std::vector<Shown> out;
+    size_t start = 0;
+    for (size_t i = 1; i <= in.size(); i++) {
+        if (i < in.size() && in[i] == in[start])
+            continue;
+        // refresh in which the frame appears and the one it is replaced in
+        long from = std::lround(start * 1e6 / fps / period_us);
+        long to = std::lround(i * 1e6 / fps / period_us);
+        if (to > from) {
+            if (!out.empty() && out.back().frame == in[start])
+                out.back().hold += unsigned(to - from);
+            else
+                out.push_back({in[start], unsigned(to - from)});
+        }
+        start = i;
+    }
+    return out;
+}
+
+///////////////////////////////////////////////////////////
+// code one 64 byte delta with the fewest bytes, history = window contents
+static void pack_frame(std::vector<unsigned char> &out, std::vector<unsigned char> &history,
+                       const unsigned char *delta, unsigned window, size_t &tokens)
+{
+    // h[window + i] is delta byte i, h[0..window) the bytes decoded before it
+    std::vector<unsigned char> h(history.end() - window, history.end());
+    h.insert(h.end(), delta, delta + 64);
+
+    unsigned cost[65], len[65], kind[65], dist[65];
+    cost[64] = 0;
+    for (int i = 63; i >= 0; i--) {
+        cost[i] = ~0u;
+        unsigned zeros = 0;
+        while (i + zeros < 64 && delta[i + zeros] == 0)
+            zeros++;
+        for (unsigned n = 1; n <= zeros; n++) {
+            if (1 + cost[i + n] < cost[i]) {
+                cost[i] = 1 + cost[i + n];
+                len[i] = n; kind[i] = 0;
+            }
+        }
+        for (unsigned n = 1; i + n <= 64; n++) {
+            if (1 + n + cost[i + n] < cost[i]) {
+                cost[i] = 1 + n + cost[i + n];
+                len[i] = n; kind[i] = 1;
+            }
+        }
+        for (unsigned d = 1; d <= window; d++) {
+            unsigned n = 0;
+            while (i + n < 64 && h[window + i + n - d] == h[window + i + n])
+                n++;
+            for (; n >= MIN_MATCH; n--) {
+                if (2 + cost[i + n] < cost[i]) {
+                    cost[i] = 2 + cost[i + n];
+                    len[i] = n; kind[i] = 2; dist[i] = d;
+                }
+            }
+        }
+    }
+
+    for (unsigned i = 0; i < 64; i += len[i], tokens++) {
+        if (kind[i] == 0)
+            out.push_back(len[i] - 1);
+        else if (kind[i] == 1) {
+            out.push_back(0x40 | (len[i] - 1));
+            out.insert(out.end(), delta + i, delta + i + len[i]);
+        }
+        else {
+            out.push_back(0x80 | (len[i] - MIN_MATCH));
+            out.push_back(dist[i] - 1);
+        }
+    }
+    history.insert(history.end(), delta, delta + 64);
+    history.erase(history.begin(), history.end() - window);
+}
+
+static std::vector<unsigned char> pack(const std::vector<Shown> &shown, unsigned window, size_t &tokens)
+{
+    std::vector<unsigned char> out, history(window, 0);
+    Frame prev{};
+    for (const Shown &s : shown) {
+        unsigned char delta[64];
+        for (int i = 0; i < 64; i++)
+            delta[i] = s.frame[i] ^ prev[i];
+        for (unsigned hold = s.hold; hold > 0; ) {
+            unsigned step = std::min(hold, 255u);
+            out.push_back(step);
+            pack_frame(out, history, delta, window, tokens);
+            std::fill(delta, delta + 64, 0); // long holds go on as empty frames
+            hold -= step;
+        }
+        prev = s.frame;
+    }
+    out.push_back(0);
+    return out;
+}
+
+///////////////////////////////////////////////////////////
+// decode like the firmware does, counting the bytes fetched per frame
+static std::vector<Shown> unpack(const std::vector<unsigned char> &in, unsigned window, size_t &max_read)
+{
+    std::vector<Shown> out;
+    std::vector<unsigned char> ring(window, 0);
+    unsigned wpos = 0;
+    Frame shown{};
+    size_t p = 0;
+    max_read = 0;
+    while (in.at(p) != 0) {
+        size_t first = p;
+        unsigned hold = in[p++];
+        Frame next;
+        for (unsigned pos = 0; pos < 64;) {
+            unsigned token = in.at(p++), n, from = 0;
+            if (token & 0x80) {
+                n = (token & 0x7f) + MIN_MATCH;
+                from = wpos - in.at(p++) - 1;
+            }
+            else
+                n = (token & 0x3f) + 1;
+            if (pos + n > 64)
+                throw std::runtime_error("token runs past the frame");
+            for (; n > 0; n--, pos++) {
+                unsigned char v = 0;
+                if (token & 0x80)
+                    v = ring[from++ & (window - 1)];
+                else if (token & 0x40)
+                    v = in.at(p++);
+                ring[wpos++ & (window - 1)] = v;
+                next[pos] = shown[pos] ^ v;
+            }
+        }
+        max_read = std::max(max_read, p - first);
+        if (!out.empty() && out.back().frame == next)
+            out.back().hold += hold;
+        else
+            out.push_back({next, hold});
+        shown = next;
+    }
+    return out;
+}
+
+///////////////////////////////////////////////////////////
+static void emit_bytes(std::ostream &out, const std::vector<unsigned char> &bytes)
+{
+    for (size_t i = 0; i < bytes.size(); i++) {
+        char hex[8];
+        std::snprintf(hex, sizeof hex, "0x%02x", bytes[i]);
+        out << (i % 16 == 0 ? "    " : "") << hex
+            << (i + 1 == bytes.size() ? "\n" : i % 16 == 15 ? ",\n" : ",");
+    }
+}
+
+static const char usage[] =
+    "usage: cubepack [-t keil|sdcc] [-r fps] [-p us] [-w window] [-n name] [-o out.h] file.raw...\n";
+
+int main(int argc, char **argv)
+{
+    bool sdcc = false;
+    double fps = 61, period = 16384;
+    unsigned window = 64;
+    std::string name = "anim", out_name;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc) {
+            std::string t = argv[++i];
+            if (t != "keil" && t != "sdcc") {
+                std::cerr << "unknown target " << t << "\n";
+                return 1;
+            }
+            sdcc = t == "sdcc";
+        }
+        else if (arg == "-r" && i + 1 < argc)
+            fps = std::atof(argv[++i]);
+        else if (arg == "-p" && i + 1 < argc)
+            period = std::atof(argv[++i]);
+        else if (arg == "-w" && i + 1 < argc)
+            window = std::atoi(argv[++i]);
+        else if (arg == "-n" && i + 1 < argc)
+            name = argv[++i];
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else if (arg[0] != '-')
+            inputs.push_back(arg);
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (inputs.empty() || fps <= 0 || period <= 0 || window < 4 || window > 256 || (window & (window - 1))) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    std::vector<unsigned char> all;
+    std::vector<size_t> index;
+    size_t total_raw = 0, total_shown = 0;
+    // ratio: against the raw stream, shown: against 64 bytes per shown frame
+    std::fprintf(stderr, "%-20s %7s %7s %9s %8s %8s %8s %8s %9s\n",
+                 "animation", "frames", "shown", "raw", "packed", "ratio", "shown", "tok/frm", "max read");
+    for (const std::string &file : inputs) {
+        std::ifstream f(file, std::ios::binary);
+        if (!f) {
+            std::cerr << "cannot read " << file << "\n";
+            return 1;
+        }
+        std::vector<Frame> frames;
+        Frame fr;
+        while (f.read(reinterpret_cast<char *>(fr.data()), 64))
+            frames.push_back(fr);
+        if (f.gcount() != 0) {
+            std::cerr << file << ": size is not a multiple of 64 bytes\n";
+            return 1;
+        }
+
+        std::vector<Shown> shown = timeline(frames, fps, period);
+        if (shown.empty()) {
+            std::cerr << file << ": shorter than one refresh\n";
+            return 1;
+        }
+        size_t tokens = 0, max_read = 0, coded = 0;
+        std::vector<unsigned char> packed = pack(shown, window, tokens);
+        for (const Shown &s : shown)
+            coded += (s.hold + 254) / 255;
+        std::vector<Shown> check = unpack(packed, window, max_read);
+        bool same = check.size() == shown.size();
+        for (size_t i = 0; same && i < check.size(); i++)
+            same = check[i].frame == shown[i].frame && check[i].hold == shown[i].hold;
+        if (!same) {
+            std::cerr << file << ": decoded stream does not match\n";
+            return 1;
+        }
+
+        size_t raw = frames.size() * 64;
+        std::fprintf(stderr, "%-20s %7zu %7zu %9zu %8zu %6.1f:1 %6.1f:1 %8.2f %9zu\n", file.c_str(),
+                     frames.size(), shown.size(), raw, packed.size(), double(raw) / packed.size(),
+                     double(shown.size() * 64) / packed.size(), double(tokens) / coded, max_read);
+        total_shown += shown.size() * 64;
+        index.push_back(all.size());
+        all.insert(all.end(), packed.begin(), packed.end());
+        total_raw += raw;
+    }
+    index.push_back(all.size());
+    size_t flash = all.size() + index.size() * 2;
+    std::fprintf(stderr, "%-20s %7s %7s %9zu %8zu %6.1f:1 %6.1f:1   flash %zu bytes\n", "total", "", "",
+                 total_raw, all.size(), double(total_raw) / all.size(), double(total_shown) / all.size(), flash);
+    if (all.size() > 0xffff) {
+        std::cerr << "packed animations exceed 64k\n";
+        return 1;
+    }
+
+    std::ostringstream out;
+    out << "// generated by cubepack - do not edit\n";
+    for (const std::string &file : inputs)
+        out << "// " << (&file - &inputs[0]) << ": " << file << "\n";
+    std::string upper = name;
+    for (char &c : upper)
+        c = std::toupper((unsigned char)c);
+    out << "\n#define " << upper << "_COUNT " << inputs.size() << "\n";
+    out << "#define " << upper << "_WINDOW " << window
+        << "   // decoder history bytes\n\n";
+    out << (sdcc ? "__code uchar " : "uchar code ") << name << "[" << all.size() << "] = {\n";
+    emit_bytes(out, all);
+    out << "};\n\n";
+    out << (sdcc ? "__code uint " : "uint code ") << name << "_index[" << index.size() << "] = {\n";
+    for (size_t i = 0; i < index.size(); i++)
+        out << (i % 8 == 0 ? "    " : "") << index[i]
+            << (i + 1 == index.size() ? "\n" : i % 8 == 7 ? ",\n" : ",");
+    out << "};\n";
+
+    if (out_name.empty()) {
+        std::cout << out.str();
+    }
+    else {
+        std::ofstream f(out_name, std::ios::binary);
+        f << out.str();
+        if (!f) {
+            std::cerr << "cannot write " << out_name << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
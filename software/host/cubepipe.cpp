@@ -0,0 +1,173 @@
+// cubepipe - streams frames to the cube through the render -> encode ->
+// transmit pipeline of cubepipe.h and reports what every stage did, or with
+// -1 through the old single loop (render, write, wait for the line) to
+// compare. The frames come from a raw frame file (as written by fx888 or
+// cubevox) played at the frame rate, or a test pattern.
+//
+// usage: cubepipe [-r fps] [-b bps] [-n frames] [-w ms] [-q depth] [-1]
+//                 [-H histograms.csv] [-o out] [file.raw]
+//
+//   -r fps      render rate (default 30)
+//   -b bps      line rate the transmit stage paces to (default 9600)
+//   -n frames   frames of the test pattern (default 300)
+//   -w ms       extra render time a frame, exponentially distributed with
+//               this mean, to try slow and uneven renders (default 0)
+//   -q depth    packets queued for transmit (default 1)
+//   -1          single loop instead of the pipeline
+//   -H file     write the stage histograms as CSV
+//   -o out      file or (configured) serial device, default stdout
+//
+// Stage latencies (mean, p50, p99, max), frames dropped at render and
+// encode and the line use go to stderr.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cubepipe.h"
+
+static const char usage[] =
+    "usage: cubepipe [-r fps] [-b bps] [-n frames] [-w ms] [-q depth] [-1] [-H histograms.csv] [-o out] [file.raw]\n";
+
+int main(int argc, char **argv)
+{
+    double fps = 30, bps = 9600, work_ms = 0;
+    unsigned long test_frames = 300;
+    size_t depth = 1;
+    bool single = false;
+    std::string in_name, out_name, hist_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-r" && i + 1 < argc)
+            fps = std::atof(argv[++i]);
+        else if (arg == "-b" && i + 1 < argc)
+            bps = std::atof(argv[++i]);
+        else if (arg == "-n" && i + 1 < argc)
+            test_frames = std::atol(argv[++i]);
+        else if (arg == "-w" && i + 1 < argc)
+            work_ms = std::atof(argv[++i]);
+        else if (arg == "-q" && i + 1 < argc)
+            depth = std::atoi(argv[++i]);
+        else if (arg == "-1")
+            single = true;
+        else if (arg == "-H" && i + 1 < argc)
+            hist_name = argv[++i];
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else if (arg[0] != '-' && in_name.empty())
+            in_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (fps <= 0 || bps <= 0 || work_ms < 0 || depth == 0) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    std::vector<Frame> frames;
+    if (!in_name.empty()) {
+        std::ifstream f(in_name, std::ios::binary);
+        if (!f) {
+            std::cerr << "cannot read " << in_name << "\n";
+            return 1;
+        }
+        for (Frame fr; f.read(reinterpret_cast<char *>(fr.data()), 64);)
+            frames.push_back(fr);
+    }
+    else
+        for (unsigned long n = 0; n < test_frames; n++) {
+            Frame fr{};                 // a plane sweeping along x
+            for (unsigned i = 0; i < 64; i++)
+                fr[i] = 1 << (n % 8);
+            frames.push_back(fr);
+        }
+
+    FILE *out = out_name.empty() ? stdout : std::fopen(out_name.c_str(), "wb");
+    if (!out) {
+        std::cerr << "cannot write " << out_name << "\n";
+        return 1;
+    }
+
+    std::mt19937 rng(1);
+    std::exponential_distribution<double> work(work_ms > 0 ? 1 / work_ms : 1);
+    auto render = [&](Frame &f, unsigned long n, double) {
+        if (n >= frames.size())
+            return false;
+        if (work_ms > 0)
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(work(rng)));
+        f = frames[n];
+        return true;
+    };
+    auto write = [&](const unsigned char *p, size_t len) {
+        if (std::fwrite(p, 1, len, out) != len)
+            return false;
+        return std::fflush(out) == 0;
+    };
+
+    Pipeline pipe;
+    pipe.render = render;
+    pipe.write = write;
+    pipe.fps = fps;
+    pipe.bps = bps;
+    pipe.tx_depth = depth;
+    if (!single)
+        pipe.run();
+    else {
+        // the old way: every stage waits for the one before it
+        double t0 = Pipeline::now(), line = 0;
+        std::vector<unsigned char> packet;
+        for (unsigned long n = 0;; n++) {
+            double due = t0 + n / fps;
+            if (due < Pipeline::now()) {    // behind: skip to the frame due now
+                pipe.render_dropped++;
+                continue;
+            }
+            std::this_thread::sleep_for(std::chrono::duration<double>(due - Pipeline::now()));
+            Frame f;
+            double start = Pipeline::now();
+            if (!render(f, n, n / fps))
+                break;
+            pipe.rendered++;
+            pipe.render_us.add((Pipeline::now() - start) * 1e6);
+            packet.clear();
+            frame_packet(packet, f);
+            if (!write(packet.data(), packet.size())) {
+                pipe.failed = true;
+                break;
+            }
+            line = std::max(line, Pipeline::now()) + packet.size() * 10 / bps;
+            std::this_thread::sleep_for(std::chrono::duration<double>(line - Pipeline::now()));
+            pipe.sent++;
+            pipe.bytes += packet.size();
+            pipe.total_us.add((line - start) * 1e6);
+        }
+        pipe.seconds = Pipeline::now() - t0;
+    }
+    if (out != stdout)
+        std::fclose(out);
+    if (pipe.failed) {
+        std::cerr << "cannot write " << (out_name.empty() ? "stdout" : out_name) << "\n";
+        return 1;
+    }
+
+    pipe.report(stderr);
+    if (!hist_name.empty()) {
+        FILE *h = std::fopen(hist_name.c_str(), "w");
+        if (!h) {
+            std::cerr << "cannot write " << hist_name << "\n";
+            return 1;
+        }
+        pipe.export_csv(h);
+        std::fclose(h);
+    }
+    return 0;
+}
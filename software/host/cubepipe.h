@@ -0,0 +1,270 @@
+// cubepipe.h - a three stage frame pipeline for host tools that stream to a
+// cube: render -> encode -> transmit, one thread each, joined by lock free
+// single producer/single consumer queues, so a slow render does not stall the
+// line and a busy line does not stall rendering.
+//
+// Backpressure comes from the line: transmit sends a packet and waits until
+// its last byte is out at bps, so the encode -> transmit queue fills when the
+// line is busy. Encode then holds on to the newest frame and drops the older
+// ones (latest frame wins) instead of letting stale frames queue up. Render
+// runs on its own clock and only drops a frame itself when the render queue
+// is full.
+//
+// Every frame is timed through the stages into log scale histograms:
+//   render    the render call
+//   encode    rendered -> its packet is queued for transmit (held frames wait)
+//   transmit  queued -> its last byte is out on the line
+//   total     render start -> last byte out
+#ifndef CUBEPIPE_H
+#define CUBEPIPE_H
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cubelink.h"
+
+///////////////////////////////////////////////////////////
+// bounded lock free queue for one producer and one consumer thread
+template <class T>
+class SpscQueue {
+  public:
+    explicit SpscQueue(size_t capacity) : slots(capacity + 1) {}
+
+    bool push(T &&v)
+    {
+        size_t t = tail.load(std::memory_order_relaxed), next = (t + 1) % slots.size();
+        if (next == head.load(std::memory_order_acquire))
+            return false;               // full
+        slots[t] = std::move(v);
+        tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &v)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return false;               // empty
+        v = std::move(slots[h]);
+        head.store((h + 1) % slots.size(), std::memory_order_release);
+        return true;
+    }
+
+    bool full() const
+    {
+        return (tail.load(std::memory_order_acquire) + 1) % slots.size() == head.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::vector<T> slots;               // one slot stays empty
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+};
+
+///////////////////////////////////////////////////////////
+// latency histogram in us: 8 buckets an octave (~9% wide) from 1 us up
+struct Histogram {
+    static const unsigned SUB = 8, OCTAVES = 32;
+    std::vector<uint64_t> count = std::vector<uint64_t>(1 + SUB * OCTAVES, 0);
+    uint64_t n = 0;
+    double sum = 0, max = 0;
+
+    static unsigned bucket(double us)
+    {
+        if (us < 1)
+            return 0;
+        int oct = std::ilogb(us);
+        unsigned sub = unsigned((us / std::ldexp(1.0, oct) - 1) * SUB);
+        return std::min(1 + unsigned(oct) * SUB + sub, SUB * OCTAVES);
+    }
+
+    static double low(unsigned b)       // lower edge of bucket b
+    {
+        if (b == 0)
+            return 0;
+        b--;
+        return std::ldexp(1.0 + double(b % SUB) / SUB, int(b / SUB));
+    }
+
+    void add(double us)
+    {
+        count[bucket(us)]++;
+        n++;
+        sum += us;
+        if (us > max)
+            max = us;
+    }
+
+    // upper edge of the bucket holding the q quantile
+    double quantile(double q) const
+    {
+        uint64_t want = uint64_t(std::ceil(q * n)), seen = 0;
+        for (unsigned b = 0; b < count.size(); b++)
+            if ((seen += count[b]) >= want && count[b])
+                return std::min(low(b + 1), max);
+        return max;
+    }
+};
+
+///////////////////////////////////////////////////////////
+struct Pipeline {
+    // fills the frame for time t (s since the start), false ends the stream
+    std::function<bool(Frame &, unsigned long n, double t)> render;
+    // writes a packet out, false on an error
+    std::function<bool(const unsigned char *, size_t)> write;
+    double fps = 30, bps = 9600;
+    size_t render_depth = 4, tx_depth = 1;  // queue capacities in frames
+
+    Histogram render_us, encode_us, transmit_us, total_us;
+    unsigned long rendered = 0, render_dropped = 0, encode_dropped = 0, sent = 0;
+    size_t bytes = 0;
+    double seconds = 0;
+    bool failed = false;
+
+    struct Item {
+        Frame f{};
+        std::vector<unsigned char> packet;
+        double start = 0, rendered = 0, queued = 0;     // steady clock, s
+        bool last = false;              // end of the stream
+    };
+
+    static double now()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void nap()                   // the queues have no waiting, poll them gently
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    void run()
+    {
+        SpscQueue<Item> to_encode(render_depth), to_send(tx_depth);
+        std::atomic<bool> stop{false};
+        double t0 = now();
+
+        std::thread render_thread([&] {
+            for (unsigned long n = 0; !stop; n++) {
+                double due = t0 + n / fps;
+                if (due > now())
+                    std::this_thread::sleep_for(std::chrono::duration<double>(due - now()));
+                Item item;
+                item.start = now();
+                item.last = !render(item.f, n, n / fps);
+                item.rendered = now();
+                if (!item.last) {
+                    rendered++;
+                    render_us.add((item.rendered - item.start) * 1e6);
+                }
+                if (item.last) {
+                    while (!to_encode.push(std::move(item)) && !stop)
+                        nap();
+                    return;
+                }
+                if (!to_encode.push(std::move(item)))
+                    render_dropped++;   // encode is not keeping up at all
+            }
+        });
+
+        std::thread encode_thread([&] {
+            Item held, item;
+            bool holding = false, ending = false;
+            while (!stop) {
+                while (!ending && to_encode.pop(item)) {
+                    if (item.last) {
+                        ending = true;
+                        break;
+                    }
+                    if (holding)
+                        encode_dropped++;   // the newest frame wins
+                    held = std::move(item);
+                    holding = true;
+                }
+                if (holding && !to_send.full()) {
+                    held.packet.clear();
+                    frame_packet(held.packet, held.f);
+                    held.queued = now();
+                    encode_us.add((held.queued - held.rendered) * 1e6);
+                    to_send.push(std::move(held));
+                    holding = false;
+                }
+                else if (ending && !holding) {
+                    Item end;
+                    end.last = true;
+                    while (!to_send.push(std::move(end)) && !stop)
+                        nap();
+                    return;
+                }
+                else
+                    nap();
+            }
+        });
+
+        std::thread send_thread([&] {
+            double line = 0;                // when the last byte is out
+            Item item;
+            for (;;) {
+                if (!to_send.pop(item)) {
+                    nap();
+                    continue;
+                }
+                if (item.last)
+                    return;
+                if (!write(item.packet.data(), item.packet.size())) {
+                    failed = true;
+                    return;
+                }
+                line = std::max(line, now()) + item.packet.size() * 10 / bps;
+                double wait = line - now();
+                if (wait > 0)               // the line is the backpressure
+                    std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+                sent++;
+                bytes += item.packet.size();
+                transmit_us.add((line - item.queued) * 1e6);
+                total_us.add((line - item.start) * 1e6);
+            }
+        });
+
+        send_thread.join();
+        stop = true;                        // ends the other stages after a write error
+        render_thread.join();
+        encode_thread.join();
+        seconds = now() - t0;
+    }
+
+    void report(FILE *out) const
+    {
+        std::fprintf(out, "%lu rendered, %lu sent, dropped %lu at render, %lu at encode (latest wins), "
+                     "%zu bytes in %.2f s, line %.0f%% busy\n", rendered, sent, render_dropped, encode_dropped,
+                     bytes, seconds, seconds > 0 ? bytes * 10 / bps / seconds * 100 : 0.0);
+        std::fprintf(out, "%-9s %10s %10s %10s %10s\n", "stage", "mean us", "p50 us", "p99 us", "max us");
+        const std::pair<const char *, const Histogram *> stages[] = {
+            {"render", &render_us}, {"encode", &encode_us}, {"transmit", &transmit_us}, {"total", &total_us}};
+        for (const auto &s : stages)
+            std::fprintf(out, "%-9s %10.0f %10.0f %10.0f %10.0f\n", s.first, s.second->n ? s.second->sum / s.second->n : 0.0,
+                         s.second->quantile(0.5), s.second->quantile(0.99), s.second->max);
+    }
+
+    // the histograms as CSV: stage,low_us,high_us,count (non empty buckets)
+    void export_csv(FILE *out) const
+    {
+        std::fprintf(out, "stage,low_us,high_us,count\n");
+        const std::pair<const char *, const Histogram *> stages[] = {
+            {"render", &render_us}, {"encode", &encode_us}, {"transmit", &transmit_us}, {"total", &total_us}};
+        for (const auto &s : stages)
+            for (unsigned b = 0; b < s.second->count.size(); b++)
+                if (s.second->count[b])
+                    std::fprintf(out, "%s,%.1f,%.1f,%llu\n", s.first, Histogram::low(b), Histogram::low(b + 1),
+                                 (unsigned long long)s.second->count[b]);
+    }
+};
+
+#endif
@@ -0,0 +1,168 @@
+// cubereplay - plays a cubecap log back to a port (a cube or cubeemu) with
+// the timing it was captured with, or time scaled, and reports how late the
+// writes were. Without a port it reports what the log holds.
+//
+// usage: cubereplay [-s scale] [-b bps] [-d] log [port]
+//
+//   -s scale  multiplies the captured times: 2 - half speed, 0.5 - twice as
+//             fast, 0 - back to back (default 1)
+//   -b bps    line rate set on a tty port (default: the rate in the log)
+//   -d        dump the records as text: <ms> <bytes> <hex...>
+//   log       capture log written by cubecap
+//   port      serial device or pty to write to
+//
+// The report: bytes and writes, the busiest second against what the line
+// carries at bps, the longest gap, and for a replay the lateness of every
+// write against its scaled time (mean, p99, max).
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "cubecap.h"
+#include "serial.h"
+
+static void sleep_until(uint64_t ns)
+{
+    timespec ts = {time_t(ns / 1000000000u), long(ns % 1000000000u)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        ;
+}
+
+static const char usage[] = "usage: cubereplay [-s scale] [-b bps] [-d] log [port]\n";
+
+int main(int argc, char **argv)
+{
+    double scale = 1;
+    unsigned bps = 0;
+    bool dump = false;
+    std::string log_name, port_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-s" && i + 1 < argc)
+            scale = std::atof(argv[++i]);
+        else if (arg == "-b" && i + 1 < argc)
+            bps = std::atoi(argv[++i]);
+        else if (arg == "-d")
+            dump = true;
+        else if (arg[0] != '-' && log_name.empty())
+            log_name = arg;
+        else if (arg[0] != '-' && port_name.empty())
+            port_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (log_name.empty() || scale < 0) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    FILE *file = std::fopen(log_name.c_str(), "rb");
+    if (!file) {
+        std::cerr << "cannot read " << log_name << "\n";
+        return 1;
+    }
+    CapReader cap(file);
+    if (!cap.header()) {
+        std::cerr << log_name << ": not a cubecap log\n";
+        return 1;
+    }
+    std::vector<CapRecord> records;
+    for (CapRecord r; cap.next(r);)
+        records.push_back(r);
+    std::fclose(file);
+    if (!bps)
+        bps = cap.bps;
+
+    int port = -1;
+    if (!port_name.empty()) {
+        port = open(port_name.c_str(), O_WRONLY | O_NOCTTY);
+        if (port < 0) {
+            std::cerr << "cannot open " << port_name << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+        if (bps_speed(bps) != B0)
+            make_raw(port, bps);
+    }
+
+    // what the log holds
+    size_t bytes = 0;
+    uint64_t gap = 0;
+    size_t busiest = 0;                 // bytes in the busiest second
+    std::deque<std::pair<uint64_t, size_t>> second;
+    size_t in_second = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        const CapRecord &r = records[i];
+        bytes += r.bytes.size();
+        if (i)
+            gap = std::max(gap, r.t - records[i - 1].t);
+        second.push_back({r.t, r.bytes.size()});
+        in_second += r.bytes.size();
+        while (second.front().first + 1000000000u <= r.t) {
+            in_second -= second.front().second;
+            second.pop_front();
+        }
+        busiest = std::max(busiest, in_second);
+        if (dump) {
+            std::printf("%.3f %zu", r.t * 1e-6, r.bytes.size());
+            for (unsigned char b : r.bytes)
+                std::printf(" %02x", b);
+            std::printf("\n");
+        }
+    }
+    double span = records.empty() ? 0 : (records.back().t - records.front().t) * 1e-9;
+    std::fprintf(stderr, "%zu bytes in %zu writes over %.3f s, captured at %u bps\n", bytes, records.size(), span,
+                 cap.bps);
+    std::fprintf(stderr, "busiest second %zu bytes (the line carries %u), longest gap %.1f ms\n", busiest,
+                 bps / 10, gap * 1e-6);
+    if (port < 0)
+        return 0;
+
+    // replay: every write at its scaled time, lateness measured after it
+    std::vector<double> late;
+    uint64_t t0 = clock_ns() + 10000000u;   // 10 ms to settle
+    uint64_t base = records.empty() ? 0 : records.front().t;
+    for (const CapRecord &r : records) {
+        uint64_t due = t0 + uint64_t((r.t - base) * scale);
+        sleep_until(due);
+        uint64_t at = clock_ns();
+        late.push_back((at - due) * 1e-6);
+        for (size_t done = 0; done < r.bytes.size();) {
+            ssize_t w = write(port, r.bytes.data() + done, r.bytes.size() - done);
+            if (w < 0 && errno == EINTR)
+                continue;
+            if (w <= 0) {
+                std::cerr << "cannot write " << port_name << ": " << std::strerror(errno) << "\n";
+                return 1;
+            }
+            done += w;
+        }
+    }
+    tcdrain(port);                      // until the port has taken the last byte
+    double took = (clock_ns() - t0) * 1e-9;
+    close(port);
+    if (!late.empty()) {
+        double mean = 0;
+        for (double l : late)
+            mean += l;
+        mean /= late.size();
+        std::sort(late.begin(), late.end());
+        std::fprintf(stderr, "replayed at %.2fx in %.3f s, writes late by mean %.3f ms, p99 %.3f ms, max %.3f ms\n",
+                     scale ? 1 / scale : 0.0, took, mean, late[late.size() * 99 / 100],
+                     late.back());
+    }
+    return 0;
+}
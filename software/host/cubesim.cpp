@@ -0,0 +1,736 @@
+// cubesim - runs the v2 firmware (firmware/v2-sdcc/firmware.c, built with
+// -DHOST_BUILD against hostsdcc.h) natively and checks it against models of
+// the serial line and the cube. compile.sh links it twice: cubesim with the
+// firmware as shipped (legacy 0xF2 frames enabled) and cubesim_nolegacy
+// built with NO_LEGACY.
+//
+// usage: cubesim fuzz [-n frames] [-p percent] [-s seed] [-f packet|legacy]
+//        cubesim duty [-l lit,...] [-d droop]
+//        cubesim power [-t seconds]
+//        cubesim boot [-o ms]
+//
+// fuzz: random frames go through receive() as CMD_FRAME packets (or legacy
+// 0xF2 frames with -f legacy), percent of them (default 10) hit by one
+// fault: a bit flip, a dropped byte or a byte replaced by a random one.
+// Reported: the wire bytes of a frame and the frame rate that leaves on the
+// line, clean and hit frames shown, frames shown that were never sent, and
+// the frames lost from a fault until the next frame is shown correctly.
+// A fault that turns a packet byte into 0xF2 only drops the packet; a
+// legacy frame opened there instead (a hijack) would take the next 64 bytes
+// unchecked and show them. Hijacks are counted, and the case is also run on
+// its own first. The one fault no receiver can tell from a legacy frame is
+// a packet's 0xF1 replaced by 0xF2 between packets; those are counted apart.
+// A packet with a fault passes the crc-8 only if the fault changes its
+// length and the receiver misses the next start marker too (a dropped 0xF1,
+// or a packet left open by the previous fault), 1 in 256 of those.
+// Exit status 1 on a hijack, a clean frame lost, a legacy frame showing
+// what was never sent other than after a 0xF1 turned 0xF2, or more than
+// 1 in 256 of the frames with a fault shown wrongly as packets.
+//
+// duty: a trace of the scan interrupt print() over one cube refresh, with
+// fixed and with equalised layer on-times (command 0x02), on a frame with
+// -l lit leds per layer (default 64,32,16,8,4,2,1,0). For every layer the
+// timer0 counts it stays lit, the duty of each of its voxels, and the
+// brightness of a voxel under a current droop model: duty / (1 + lit /
+// droop), droop the lit leds that halve a layer's brightness (-d, default
+// 64 as SCAN_DROOP). The model is not measured on a cube.
+//
+// power and boot run cube_main() on a virtual clock: time in us (timer0
+// counts 1 per us), print() runs when timer0 runs out, uart_isr() when the
+// next byte of the line has arrived. Time passes in idle() (asleep), in
+// delay5us() (taken as 5 us) and in IAP commands (the datasheet times the
+// firmware quotes: erase 21 ms, program 55 us a byte, read 1 us); all the
+// other code takes none. Every run starts from reset in a child process.
+// Bytes arriving during an IAP command are passed on late, not lost.
+//
+// power: -t seconds (default 2, after 1 s to settle) of four workloads:
+// the demo (no saved settings), a blank cube and a static random frame
+// (saved with command 0x09 and CFG_UART), and CMD_FRAME packets of random
+// frames streamed at 9600 bps. Reported per second: scan and uart
+// interrupts, 573 row loads (the two delay(3) of each), wake-ups from
+// idle(), and the share of the time the cpu sleeps in IDLE. Current draw
+// is not modelled.
+//
+// boot: a CMD_FRAME packet sent -o ms (default 0 .. 40 in 0.25 ms steps)
+// after reset, at 9600 and 57600 bps, with no saved settings (demo
+// running) and with saved CFG_UART settings. Reported: the time from its
+// last byte until the scan first lights a layer of it, best and worst.
+// Also the time the cpu halts for a save (command 0x09 with the start
+// frame) and when the saved start frame first lights after reset. Exit
+// status 1 if a frame is never shown.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "cubelink.h"
+
+extern "C" {
+// the special function registers of hostsdcc.h
+volatile unsigned char P0, P1, P2, PCON, SCON, SBUF, AUXR, AUXR1, BRT, TMOD, TH0, TL0, TH1, TL1;
+volatile unsigned char IAP_DATA, IAP_ADDRH, IAP_ADDRL, IAP_CMD, IAP_TRIG, IAP_CONTR;
+volatile unsigned char EA, ES, ET0, TR0, TF0, TR1, RI, TI;
+
+// the firmware
+extern volatile unsigned char display[2][8][8];
+extern volatile unsigned char frame, temp;
+extern unsigned char rx_state;
+extern unsigned char scan_equalise;
+extern volatile unsigned char layer;
+void receive(unsigned char value);
+void swap();
+void print();
+void uart_isr();
+void cube_main();
+}
+
+static const unsigned char RX_IDLE = 0, RX_RAW = 1;  // rx_state of the firmware
+
+static bool showing(const Frame &f)
+{
+    return std::equal(f.begin(), f.end(), &display[frame][0][0]);
+}
+
+///////////////////////////////////////////////////////////
+// fuzz: the packet framing under line faults
+
+struct Fuzz {
+    unsigned long frames = 0, hit = 0, bytes = 0;
+    unsigned long clean_shown = 0, hit_shown = 0;
+    unsigned long lost = 0;             // clean frames not shown
+    unsigned long garbage = 0;          // frames shown that were never sent
+    unsigned long garbage_raw = 0;      // ... of them completed as legacy frames
+    unsigned long hijacks = 0;          // legacy frames opened inside a packet
+    unsigned long start_f2 = 0;         // packets whose 0xF1 a fault made 0xF2
+    unsigned long faults = 0, recovered = 0, lost_after = 0, lost_max = 0;
+};
+
+// one fault in bytes[from..]: 0 - bit flip, 1 - dropped byte, 2 - replaced byte
+static void fault(std::vector<unsigned char> &bytes, size_t from, std::mt19937 &rng)
+{
+    size_t at = from + rng() % (bytes.size() - from);
+    switch (rng() % 3) {
+    case 0: bytes[at] ^= (unsigned char)(1 << rng() % 8); break;
+    case 1: bytes.erase(bytes.begin() + at); break;
+    default: bytes[at] ^= (unsigned char)(1 + rng() % 255); break;
+    }
+}
+
+// feed the bytes of frame f, count what the cube shows meanwhile;
+// returns true if f was shown
+static bool send(Fuzz &z, const std::vector<unsigned char> &bytes, const Frame &f, bool packets)
+{
+    bool shown = false;
+    for (unsigned char b : bytes) {
+        unsigned char before = frame, state = rx_state;
+        receive(b);
+        if (packets && state != RX_IDLE && state != RX_RAW && rx_state == RX_RAW)
+            z.hijacks++;
+        if (frame == before)
+            continue;
+        if (showing(f))
+            shown = true;
+        else {
+            z.garbage++;
+            if (state == RX_RAW)
+                z.garbage_raw++;
+        }
+    }
+    return shown;
+}
+
+static void encode(std::vector<unsigned char> &out, const Frame &f, bool packets)
+{
+    out.clear();
+    if (packets)
+        packet(out, CMD_FRAME, f.data(), 64);
+    else {
+        out.push_back(FRAME_START);
+        out.insert(out.end(), f.begin(), f.end());
+    }
+}
+
+// the documented case on its own: a packet byte turned into 0xF2, then a
+// clean packet; then a legacy frame to find out if this build takes them.
+// Returns false if the 0xF2 opens a legacy frame or the clean packet is lost.
+static bool hijack_case(bool &legacy)
+{
+    Frame a, b, c;
+    for (int i = 0; i < 64; i++) {
+        a[i] = (unsigned char)(i * 7 + 1);
+        b[i] = (unsigned char)(i * 13 + 5);
+        c[i] = (unsigned char)(i * 11 + 3);
+    }
+    std::vector<unsigned char> first, second;
+    packet(first, CMD_FRAME, a.data(), 64);
+    packet(second, CMD_FRAME, b.data(), 64);
+    first[10] = FRAME_START;
+
+    bool opened = false;
+    for (unsigned char v : first) {
+        receive(v);
+        opened |= rx_state == RX_RAW;
+    }
+    for (unsigned char v : second)
+        receive(v);
+    bool shown = showing(b);
+    std::printf("hijack case: 0xF2 in a packet %s, the next clean packet %s\n",
+                opened ? "opens a legacy frame" : "drops the packet", shown ? "is shown" : "is lost");
+    for (int i = 0; i < 64; i++)        // finish a legacy frame left open
+        if (rx_state == RX_RAW)
+            receive(0);
+
+    rx_state = RX_IDLE;
+    receive(FRAME_START);
+    for (unsigned char v : c)
+        receive(v);
+    legacy = showing(c);
+    rx_state = RX_IDLE;
+    return !opened && shown;
+}
+
+static int fuzz(int argc, char **argv)
+{
+    unsigned long n = 100000;
+    unsigned percent = 10, seed = 1;
+    bool packets = true;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            n = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "-p" && i + 1 < argc)
+            percent = std::atoi(argv[++i]);
+        else if (arg == "-s" && i + 1 < argc)
+            seed = std::atoi(argv[++i]);
+        else if (arg == "-f" && i + 1 < argc) {
+            std::string f = argv[++i];
+            if (f != "packet" && f != "legacy")
+                return -1;
+            packets = f == "packet";
+        }
+        else
+            return -1;
+    }
+    if (percent > 100)
+        return -1;
+
+    bool legacy;
+    bool hijack_ok = hijack_case(legacy);
+    if (!legacy && !packets) {
+        std::cerr << "legacy frames are disabled in this build\n";
+        return 1;
+    }
+
+    Fuzz z;
+    std::mt19937 rng(seed);
+    std::vector<unsigned char> bytes;
+    Frame f;
+    bool pending = false;               // a fault not recovered from yet
+    unsigned long since = 0;            // frames since that fault
+    for (unsigned long k = 0; k < n; k++) {
+        for (unsigned char &v : f)
+            v = (unsigned char)rng();
+        encode(bytes, f, packets);
+        bool hit = rng() % 100 < percent;
+        if (hit) {
+            fault(bytes, 0, rng);
+            z.start_f2 += packets && bytes[0] == FRAME_START;
+        }
+        z.frames++;
+        z.bytes += bytes.size();
+        bool shown = send(z, bytes, f, packets);
+        if (hit) {
+            z.hit++;
+            z.hit_shown += shown;
+        }
+        else {
+            z.clean_shown += shown;
+            z.lost += !shown;
+        }
+        if (hit && !shown && !pending) {
+            pending = true;
+            since = 0;
+            z.faults++;
+        }
+        if (pending) {
+            if (shown) {
+                pending = false;
+                z.recovered++;
+                z.lost_after += since;
+                z.lost_max = std::max(z.lost_max, since);
+            }
+            else
+                since++;
+        }
+    }
+
+    double per = double(z.bytes) / z.frames;
+    std::printf("%s, legacy frames %s in this build, %lu frames, %u%% with a fault (seed %u)\n",
+                packets ? "CMD_FRAME packets" : "legacy 0xF2 frames", legacy ? "enabled" : "disabled", z.frames, percent, seed);
+    std::printf("wire bytes: %.2f per frame (%+.1f%% over the 65 byte legacy frame), %.1f frames/s at 9600 bps, "
+                "%.1f at 57600 bps\n",
+                per, (per / 65 - 1) * 100, 960 / per, 5760 / per);
+    std::printf("clean frames shown: %lu of %lu, lost %lu\n", z.clean_shown, z.frames - z.hit, z.lost);
+    std::printf("frames with a fault shown: %lu of %lu\n", z.hit_shown, z.hit);
+    std::printf("frames shown that were never sent: %lu, %lu of them legacy frames (hijacks: %lu, 0xF1 turned "
+                "0xF2: %lu), %lu packets with faults that passed the crc\n",
+                z.garbage, z.garbage_raw, z.hijacks, z.start_f2, z.garbage - z.garbage_raw);
+    if (z.recovered)
+        std::printf("recovery: %lu faults lost their frame, the next frame shown came %.3f frames later on average, "
+                    "at most %lu (frames with faults of their own in between included)\n",
+                    z.faults, double(z.lost_after) / z.recovered, z.lost_max);
+
+    if (!packets)
+        return 0;                       // legacy frames have no check
+    // crc-8 misses 1 in 256 of the faults that change the length of a
+    // packet and take the next start marker with them; a legacy frame may
+    // only show garbage where the fault made a packet look like one
+    bool ok = hijack_ok && z.hijacks == 0 && z.lost == 0 && z.garbage_raw <= (legacy ? z.start_f2 : 0) &&
+              (z.garbage - z.garbage_raw) * 256 <= z.hit;
+    return ok ? 0 : 1;
+}
+
+///////////////////////////////////////////////////////////
+// duty: the layer scan traced interrupt by interrupt
+
+static int duty(int argc, char **argv)
+{
+    std::vector<int> lit = {64, 32, 16, 8, 4, 2, 1, 0};
+    double droop = 64;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-l" && i + 1 < argc) {
+            lit.clear();
+            std::istringstream items(argv[++i]);
+            for (std::string item; std::getline(items, item, ',');)
+                lit.push_back(std::atoi(item.c_str()));
+        }
+        else if (arg == "-d" && i + 1 < argc)
+            droop = std::atof(argv[++i]);
+        else
+            return -1;
+    }
+    if (lit.size() != 8 || droop <= 0)
+        return -1;
+    for (int n : lit)
+        if (n < 0 || n > 64)
+            return -1;
+
+    for (int mode = 0; mode < 2; mode++) {
+        scan_equalise = (unsigned char)mode;
+        for (int z = 0; z < 8; z++)
+            for (int y = 0; y < 8; y++) {
+                int n = std::min(std::max(lit[z] - y * 8, 0), 8);
+                display[temp][z][y] = (unsigned char)((1 << n) - 1);
+            }
+        swap();
+        while (layer != 0)
+            print();
+
+        // print() lights the layer it loads until the next interrupt
+        long on[8] = {0}, total = 0;
+        for (int k = 0; k < 8; k++) {
+            int z = layer;
+            print();
+            long counts = 8192 - ((TH0 << 5) | (TL0 & 0x1F));
+            total += counts;
+            if (P1 == 1 << z)
+                on[z] += counts;
+        }
+        std::printf("%s layer on-times, refresh %ld timer0 counts:\n", mode ? "equalised" : "fixed", total);
+        double lo = 1, hi = 0;
+        for (int z = 0; z < 8; z++) {
+            double d = double(on[z]) / total, b = d / (1 + lit[z] / droop);
+            if (lit[z]) {
+                lo = std::min(lo, b);
+                hi = std::max(hi, b);
+            }
+            std::printf("  z%d  lit %2d  on %5ld counts  duty/voxel %.4f  model brightness %.4f\n", z, lit[z], on[z],
+                        d, b);
+        }
+        if (hi > 0)
+            std::printf("  lit voxels: model brightness %.4f .. %.4f (max/min %.2f)\n", lo, hi, hi / lo);
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////
+// the virtual clock of power and boot
+
+static const double NEVER = 1e18;
+
+struct Clock {
+    bool on = false;                    // off: fuzz and duty call the firmware directly
+    bool in_isr = false;
+    double now = 0, next_scan = 0, next_byte = NEVER, byte_us = 0;
+    double asleep = 0, halted = 0;      // us in idle(), in IAP commands
+    std::vector<unsigned char> line;    // bytes the host sends
+    size_t sent = 0;
+    unsigned long scans = 0, bytes = 0, wakes = 0, row_delays = 0;
+    std::function<void()> watch;        // runs after every scan interrupt
+};
+
+static Clock clk;
+static unsigned char eeprom[1024];      // IAP data flash, erased
+
+static void scan_isr()
+{
+    clk.in_isr = true;
+    print();
+    clk.in_isr = false;
+    clk.scans++;
+    clk.next_scan = clk.now + (8192 - ((TH0 << 5) | (TL0 & 0x1F)));
+    if (clk.watch)
+        clk.watch();
+}
+
+static void uart_byte()
+{
+    SBUF = clk.line[clk.sent++];
+    RI = 1;
+    clk.in_isr = true;
+    uart_isr();
+    clk.in_isr = false;
+    clk.bytes++;
+    clk.next_byte = clk.sent < clk.line.size() ? clk.next_byte + clk.byte_us : NEVER;
+}
+
+// run the interrupts due up to t
+static void run_until(double t)
+{
+    for (;;) {
+        double next = std::min(clk.next_scan, clk.next_byte);
+        if (next > t)
+            break;
+        clk.now = std::max(clk.now, next);
+        if (clk.next_scan <= clk.next_byte)
+            scan_isr();
+        else
+            uart_byte();
+    }
+    clk.now = std::max(clk.now, t);
+}
+
+extern "C" void idle()
+{
+    if (!clk.on)
+        return;
+    double next = std::min(clk.next_scan, clk.next_byte);
+    clk.wakes++;
+    clk.asleep += std::max(next - clk.now, 0.0);
+    run_until(next);
+}
+
+extern "C" void delay5us()
+{
+    if (!clk.on || clk.in_isr) {        // the scan interrupt only delays in its row loads
+        clk.now += 5;
+        clk.row_delays += clk.in_isr;
+        return;
+    }
+    run_until(clk.now + 5);
+}
+
+extern "C" void host_iap()
+{
+    unsigned a = ((IAP_ADDRH << 8) | IAP_ADDRL) & (sizeof eeprom - 1);
+    double us = 0;
+    switch (IAP_CMD) {
+    case 1: IAP_DATA = eeprom[a]; us = 1; break;
+    case 2: eeprom[a] &= IAP_DATA; us = 55; break;
+    case 3: std::memset(eeprom + (a & ~511u), 0xFF, 512); us = 21000; break;
+    }
+    clk.now += us;
+    clk.halted += us;
+}
+
+// starts the clock at reset with the host sending line from at_us on
+static void power_up(const std::vector<unsigned char> &line, double at_us, unsigned bps)
+{
+    clk.on = true;
+    clk.next_scan = 8192 - (0xC0 << 5);     // the first slot, SCAN_RELOAD
+    clk.line = line;
+    clk.byte_us = 1e6 * 10 / bps;
+    clk.next_byte = line.empty() ? NEVER : at_us;
+}
+
+// runs f in a child process, from the firmware's state at reset; f sends
+// its result with reply(), the parent gets its bytes
+static std::string child(const std::function<void(int)> &f)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return "";
+    std::fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        f(fds[1]);
+        _exit(1);
+    }
+    close(fds[1]);
+    std::string out;
+    char buf[4096];
+    ssize_t n;
+    while ((n = read(fds[0], buf, sizeof buf)) > 0)
+        out.append(buf, n);
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+    return out;
+}
+
+static void reply(int fd, const void *p, size_t n)
+{
+    while (n) {
+        ssize_t w = write(fd, p, n);
+        if (w <= 0)
+            break;
+        p = (const char *)p + w;
+        n -= w;
+    }
+    _exit(0);
+}
+
+static Frame random_frame(std::mt19937 &rng)
+{
+    Frame f;
+    for (unsigned char &v : f)
+        v = (unsigned char)rng();
+    return f;
+}
+
+// the eeprom after command 0x09 with flags, level 15 and fixed scan, saved
+// with frame f on display; halted gets the time the cpu stood still
+static bool saved(unsigned char flags, const Frame &f, double &halted)
+{
+    std::string out = child([&](int fd) {
+        std::vector<unsigned char> line;
+        unsigned char save[4] = {flags, 15, 0, 0};
+        packet(line, CMD_FRAME, f.data(), 64);
+        packet(line, CMD_SAVE, save, 4);
+        power_up(line, 0, 57600);
+        clk.watch = [fd]() {
+            if (eeprom[0] == 0xC8) {        // CFG_MAGIC, programmed last
+                std::string r((const char *)eeprom, sizeof eeprom);
+                r.append((const char *)&clk.halted, sizeof clk.halted);
+                reply(fd, r.data(), r.size());
+            }
+            if (clk.now > 1e6)
+                reply(fd, "", 0);
+        };
+        cube_main();
+    });
+    if (out.size() != sizeof eeprom + sizeof halted)
+        return false;
+    std::memcpy(eeprom, out.data(), sizeof eeprom);
+    std::memcpy(&halted, out.data() + sizeof eeprom, sizeof halted);
+    return true;
+}
+
+///////////////////////////////////////////////////////////
+// power: where the time goes, per workload
+
+struct Usage {
+    double seconds, scans, bytes, row_loads, wakes, asleep;
+};
+
+static Usage measure(const std::vector<unsigned char> &line, double seconds)
+{
+    std::string out = child([&](int fd) {
+        power_up(line, 0, 9600);
+        double start = 1e6, end = start + seconds * 1e6;
+        Clock at;
+        bool counting = false;
+        clk.watch = [&]() {
+            if (!counting && clk.now >= start) {
+                counting = true;
+                at = clk;
+            }
+            if (clk.now < end)
+                return;
+            Usage u = {seconds, double(clk.scans - at.scans), double(clk.bytes - at.bytes),
+                       (clk.row_delays - at.row_delays) / 6.0, double(clk.wakes - at.wakes),
+                       (clk.asleep - at.asleep) / (clk.now - at.now)};
+            reply(fd, &u, sizeof u);
+        };
+        cube_main();
+    });
+    Usage u = {};
+    if (out.size() == sizeof u)
+        std::memcpy(&u, out.data(), sizeof u);
+    return u;
+}
+
+static int power(int argc, char **argv)
+{
+    double seconds = 2;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc)
+            seconds = std::atof(argv[++i]);
+        else
+            return -1;
+    }
+    if (seconds <= 0)
+        return -1;
+
+    std::mt19937 rng(1);
+    Frame blank = {}, still = random_frame(rng);
+    std::vector<unsigned char> stream;
+    while (stream.size() < (seconds + 1) * 960 + 200) {
+        Frame f = random_frame(rng);
+        packet(stream, CMD_FRAME, f.data(), 64);
+    }
+
+    struct Workload {
+        const char *name;
+        unsigned char flags;            // saved, 0 - none
+        Frame frame;
+        const std::vector<unsigned char> *line;
+    };
+    std::vector<unsigned char> none;
+    Workload loads[] = {
+        {"demo", 0, blank, &none},
+        {"blank", 0x01, blank, &none},          // CFG_UART
+        {"static", 0x03, still, &none},         // CFG_UART | CFG_FRAME
+        {"streaming", 0x01, blank, &stream},
+    };
+    std::printf("per second over %.1f s     scan isr  uart isr  row loads  wake-ups  asleep\n", seconds);
+    for (const Workload &w : loads) {
+        double halted;
+        std::memset(eeprom, 0xFF, sizeof eeprom);
+        if (w.flags && !saved(w.flags, w.frame, halted)) {
+            std::cerr << "cubesim: the save did not complete\n";
+            return 1;
+        }
+        Usage u = measure(*w.line, seconds);
+        if (u.seconds == 0) {
+            std::cerr << "cubesim: " << w.name << " did not run\n";
+            return 1;
+        }
+        std::printf("%-24s %9.0f %9.0f %10.0f %9.0f  %5.1f%%\n", w.name, u.scans / seconds, u.bytes / seconds,
+                    u.row_loads / seconds, u.wakes / seconds, u.asleep * 100);
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////
+// boot: time to the first frame after reset
+
+// us after reset at which the scan first lights a layer of frame f, the
+// host sending line from at_us on; -1 if it does not within 2 s
+static double lit_at(const Frame &f, const std::vector<unsigned char> &line, double at_us, unsigned bps)
+{
+    std::string out = child([&](int fd) {
+        power_up(line, at_us, bps);
+        clk.watch = [&]() {
+            double t = -1;
+            if (std::equal(f.begin(), f.end(), &display[frame][0][0]))
+                t = clk.now;
+            else if (clk.now < 2e6)
+                return;
+            reply(fd, &t, sizeof t);
+        };
+        cube_main();
+    });
+    double t = -1;
+    if (out.size() == sizeof t)
+        std::memcpy(&t, out.data(), sizeof t);
+    return t;
+}
+
+static int boot(int argc, char **argv)
+{
+    std::vector<double> offsets;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc)
+            offsets.push_back(std::atof(argv[++i]));
+        else
+            return -1;
+    }
+    if (offsets.empty())
+        for (int k = 0; k <= 160; k++)
+            offsets.push_back(k * 0.25);
+    for (double o : offsets)
+        if (o < 0)
+            return -1;
+
+    std::mt19937 rng(1);
+    Frame start = random_frame(rng), f = random_frame(rng);
+    double halted;
+    std::memset(eeprom, 0xFF, sizeof eeprom);
+    if (!saved(0x03, start, halted)) {      // CFG_UART | CFG_FRAME
+        std::cerr << "cubesim: the save did not complete\n";
+        return 1;
+    }
+    unsigned char settings[sizeof eeprom];
+    std::memcpy(settings, eeprom, sizeof eeprom);
+    std::printf("save with the start frame: %d eeprom bytes, the cpu halts %.1f ms\n", settings[1] + 3,
+                halted / 1000);
+    std::printf("saved start frame: first layer lit %.2f ms after reset\n", lit_at(start, {}, NEVER, 9600) / 1000);
+
+    std::vector<unsigned char> line;
+    packet(line, CMD_FRAME, f.data(), 64);
+    int status = 0;
+    for (int with = 0; with < 2; with++)
+        for (unsigned bps : {9600u, 57600u}) {
+            if (with)
+                std::memcpy(eeprom, settings, sizeof eeprom);
+            else
+                std::memset(eeprom, 0xFF, sizeof eeprom);
+            double best = NEVER, worst = 0, last = (line.size() - 1) * 1e6 * 10 / bps;
+            for (double o : offsets) {
+                double t = lit_at(f, line, o * 1000, bps);
+                if (t < 0) {
+                    std::printf("%s, %u bps: a frame sent %.2f ms after reset is never shown\n",
+                                with ? "saved CFG_UART" : "no settings (demo)", bps, o);
+                    status = 1;
+                    continue;
+                }
+                t -= o * 1000 + last;
+                best = std::min(best, t);
+                worst = std::max(worst, t);
+            }
+            if (worst > 0 || best < NEVER)
+                std::printf("%-20s %6u bps  first layer lit %5.2f .. %5.2f ms after the last byte\n",
+                            with ? "saved CFG_UART" : "no settings (demo)", bps, best / 1000, worst / 1000);
+        }
+    return status;
+}
+
+static const char usage[] =
+    "usage: cubesim fuzz [-n frames] [-p percent] [-s seed] [-f packet|legacy]\n"
+    "       cubesim duty [-l lit,...] [-d droop]\n"
+    "       cubesim power [-t seconds]\n"
+    "       cubesim boot [-o ms]\n";
+
+int main(int argc, char **argv)
+{
+    std::string mode = argc > 1 ? argv[1] : "";
+    int status = -1;
+    if (mode == "fuzz")
+        status = fuzz(argc, argv);
+    else if (mode == "duty")
+        status = duty(argc, argv);
+    else if (mode == "power")
+        status = power(argc, argv);
+    else if (mode == "boot")
+        status = boot(argc, argv);
+
+    if (status < 0) {
+        std::cerr << usage;
+        return 1;
+    }
+    return status;
+}
@@ -0,0 +1,247 @@
+// cubestats - polls the runtime counters of cubes running the v2 firmware
+// built with STATS and TX_ENABLED (or cubeemu) and shows them live: every
+// interval it sends CMD_STATS, reads the CMD_STATS_REPLY packets coming back
+// on the cube's TX and prints the rates over the interval per cube.
+//
+// usage: cubestats [-b bps] [-a addr] [-i ms] [-n polls] [-z] [-p] [-l log.csv] port
+//
+//   -b bps      line rate set on a tty port (default 9600)
+//   -a addr     ask one cube of a chain (default all: ADDR_ALL, replies
+//               come back if the TX of the last cube is wired to the host)
+//   -i ms       poll interval (default 1000)
+//   -n polls    stop after this many polls (default: until SIGINT/SIGTERM)
+//   -z          zero the counters at the first poll
+//   -p          plot: redraw the terminal with the last polls of every
+//               cube as strip charts instead of printing lines
+//   -l log      write every reply as CSV: time, address, the counters
+//   port        serial device or pty (e.g. the cubeemu link)
+//
+// Rates per second over the interval: rx bytes (and the share of the line
+// they used), bytes dropped with rx_buffer full, packets run, bad crcs,
+// host frames shown, frames shown from any source (effects, animations),
+// cube refreshes and scan interrupts entered late. The counters are 16 bit
+// on the cube; a difference is taken mod 65536, so at 57600 bps the
+// interval has to stay under 11 s.
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <map>
+#include <poll.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "cubelink.h"
+#include "serial.h"
+
+///////////////////////////////////////////////////////////
+// rates of one cube over the last interval
+struct Rates {
+    double rx, dropped, packets, bad, frames, swaps, refreshes, overruns;
+};
+
+struct Track {
+    CubeStats last;
+    double at = 0;
+    bool seen = false;
+    std::deque<Rates> history;          // newest last, for the plot
+    unsigned long sum_dropped = 0, sum_bad = 0, sum_overruns = 0;
+};
+
+static const size_t HISTORY = 60;
+
+// one strip chart, 4 lines high: every poll a column, 4 steps a line
+// (" .:|#"), scaled to the largest value shown
+static void strip(std::string &s, const char *name, const std::deque<Rates> &h, double Rates::*field)
+{
+    double top = 0;
+    for (const Rates &r : h)
+        top = std::max(top, r.*field);
+    char line[96];
+    std::snprintf(line, sizeof line, "%-10s max %9.1f/s\x1b[K\n", name, top);
+    s += line;
+    for (int row = 3; row >= 0; row--) {
+        s += "  ";
+        for (const Rates &r : h) {
+            int steps = top > 0 ? int(std::lround(r.*field / top * 16)) : 0;
+            if (r.*field > 0 && steps == 0)
+                steps = 1;              // every non zero value shows
+            s += " .:|#"[std::min(std::max(steps - 4 * row, 0), 4)];
+        }
+        s += "\x1b[K\n";
+    }
+}
+
+static void plot(const std::map<int, Track> &cubes, unsigned bps, double interval)
+{
+    std::string s = "\x1b[H";
+    char line[160];
+    std::snprintf(line, sizeof line, "cubestats  %u bps, every %.1f s, last %zu polls\x1b[K\n", bps, interval,
+                  HISTORY);
+    s += line;
+    for (const auto &c : cubes) {
+        if (c.second.history.empty())
+            continue;
+        const Rates &r = c.second.history.back();
+        std::snprintf(line, sizeof line,
+                      "\x1b[K\ncube %d: rx %.0f B/s (%.0f%% of the line), dropped %lu, bad crc %lu, overruns %lu, "
+                      "refresh %.1f Hz\x1b[K\n",
+                      c.first, r.rx, r.rx * 10 / bps * 100, c.second.sum_dropped, c.second.sum_bad,
+                      c.second.sum_overruns, r.refreshes);
+        s += line;
+        strip(s, "rx B/s", c.second.history, &Rates::rx);
+        strip(s, "frames/s", c.second.history, &Rates::frames);
+        strip(s, "shown/s", c.second.history, &Rates::swaps);
+        strip(s, "dropped/s", c.second.history, &Rates::dropped);
+    }
+    s += "\x1b[J";
+    std::fwrite(s.data(), 1, s.size(), stdout);
+    std::fflush(stdout);
+}
+
+static const char usage[] =
+    "usage: cubestats [-b bps] [-a addr] [-i ms] [-n polls] [-z] [-p] [-l log.csv] port\n";
+
+int main(int argc, char **argv)
+{
+    unsigned bps = 9600;
+    int addr = ADDR_ALL;
+    double interval = 1;
+    long polls = -1;
+    bool zero = false, graph = false;
+    std::string port_name, log_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-b" && i + 1 < argc)
+            bps = std::atoi(argv[++i]);
+        else if (arg == "-a" && i + 1 < argc)
+            addr = std::atoi(argv[++i]);
+        else if (arg == "-i" && i + 1 < argc)
+            interval = std::atof(argv[++i]) / 1000;
+        else if (arg == "-n" && i + 1 < argc)
+            polls = std::atol(argv[++i]);
+        else if (arg == "-z")
+            zero = true;
+        else if (arg == "-p")
+            graph = true;
+        else if (arg == "-l" && i + 1 < argc)
+            log_name = argv[++i];
+        else if (arg[0] != '-' && port_name.empty())
+            port_name = arg;
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (port_name.empty() || bps_speed(bps) == B0 || interval <= 0 || addr < 0 || addr > ADDR_ALL) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    int port = open(port_name.c_str(), O_RDWR | O_NOCTTY);
+    if (port < 0) {
+        std::cerr << "cannot open " << port_name << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    make_raw(port, bps);
+    FILE *log = nullptr;
+    if (!log_name.empty()) {
+        if (!(log = std::fopen(log_name.c_str(), "w"))) {
+            std::cerr << "cannot write " << log_name << "\n";
+            return 1;
+        }
+        std::fprintf(log, "time,address,rx,dropped,overruns,refreshes,packets,bad,frames,swaps\n");
+    }
+
+    std::map<int, Track> cubes;
+    bool zeroing = false;               // replies answer a query with STATS_ZERO
+    double t0 = now_s();
+    Receiver rx;                        // the host end of the line
+    rx.address = 0xFE;
+    rx.legacy = false;
+    rx.run = [&](unsigned char cmd, const unsigned char *p, unsigned len) {
+        CubeStats s;
+        if (cmd != CMD_STATS_REPLY || !s.parse(p, len))
+            return;                     // e.g. the query itself, passed on by the last cube
+        double at = now_s();
+        if (log)
+            std::fprintf(log, "%.3f,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", at - t0, s.address, s.rx, s.dropped,
+                         s.overruns, s.refreshes, s.packets, s.bad, s.frames, s.swaps);
+        Track &c = cubes[s.address];
+        if (c.seen && at > c.at) {
+            double dt = at - c.at;
+            auto d = [&](uint16_t now, uint16_t before) { return uint16_t(now - before) / dt; };
+            Rates r = {d(s.rx, c.last.rx), d(s.dropped, c.last.dropped), d(s.packets, c.last.packets),
+                       d(s.bad, c.last.bad), d(s.frames, c.last.frames), d(s.swaps, c.last.swaps),
+                       d(s.refreshes, c.last.refreshes), d(s.overruns, c.last.overruns)};
+            c.sum_dropped += uint16_t(s.dropped - c.last.dropped);
+            c.sum_bad += uint16_t(s.bad - c.last.bad);
+            c.sum_overruns += uint16_t(s.overruns - c.last.overruns);
+            c.history.push_back(r);
+            if (c.history.size() > HISTORY)
+                c.history.pop_front();
+            if (!graph)
+                std::printf("%8.1f cube %3u  rx %6.0f B/s %3.0f%%  dropped %5.0f/s  packets %6.1f/s  bad %4.1f/s  "
+                            "frames %5.1f/s  shown %5.1f/s  refresh %5.1f Hz  overruns %4.1f/s\n",
+                            at - t0, s.address, r.rx, r.rx * 10 / bps * 100, r.dropped, r.packets, r.bad, r.frames,
+                            r.swaps, r.refreshes, r.overruns);
+        }
+        c.last = s;
+        c.at = at;
+        c.seen = true;
+        if (zeroing)
+            c.last = CubeStats();       // the cube counts on from 0
+    };
+
+    if (graph)
+        std::fputs("\x1b[2J", stdout);
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    long sent = 0, quiet = 0;
+    double next = now_s();
+    while (!stop && (polls < 0 || sent <= polls)) {
+        double now = now_s();
+        if (now >= next) {
+            if (polls >= 0 && sent == polls)
+                break;                  // the last replies had their interval
+            if (sent && cubes.empty() && ++quiet == 3)
+                std::cerr << "no replies: is the firmware built with STATS and TX_ENABLED, is TX wired back?\n";
+            std::vector<unsigned char> q;
+            zeroing = zero && sent == 0;
+            stats_query(q, addr, zeroing);
+            if (!write_all(port, q.data(), q.size())) {
+                std::cerr << "cannot write " << port_name << ": " << std::strerror(errno) << "\n";
+                return 1;
+            }
+            sent++;
+            next += interval;
+            if (graph && !cubes.empty())
+                plot(cubes, bps, interval);
+        }
+        pollfd pfd = {port, POLLIN, 0};
+        int wait_ms = int((next - now_s()) * 1000) + 1;
+        if (poll(&pfd, 1, wait_ms < 0 ? 0 : wait_ms) > 0 && (pfd.revents & POLLIN)) {
+            unsigned char buf[256];
+            ssize_t n = read(port, buf, sizeof buf);
+            for (ssize_t i = 0; i < n; i++)
+                rx.receive(buf[i]);
+        }
+    }
+    close(port);
+    if (log)
+        std::fclose(log);
+    std::fprintf(stderr, "%ld queries, replies from %zu cubes, %lu bad crcs on the way back\n", sent, cubes.size(),
+                 rx.bad);
+    return 0;
+}
@@ -0,0 +1,348 @@
+// cubevox - voxelizes signed distance functions and OBJ meshes into cube
+// frames. Every voxel is sampled on an S x S x S grid, the share of samples
+// inside the shape is its coverage: written as grayscale or thresholded to
+// the 64 byte frames of the cube. Frames of an animation (the shape turning,
+// SDF shapes morphing into each other) render in parallel on all cores.
+//
+// usage: cubevox [-s scene | -m mesh.obj] [-n frames] [-r fps] [-w deg/s]
+//                [-S samples] [-t threshold] [-f raw|gray|packets] [-j threads] [-o out]
+//
+//   -s scene      sphere, box, torus or morph (sphere -> box -> torus, one
+//                 shape a second), default morph
+//   -m mesh.obj   a closed triangle/polygon mesh instead, fitted into the cube
+//   -n frames     length of the animation (default 120)
+//   -r fps        frame rate, sets the time of every frame (default 30)
+//   -w deg/s      turn rate about z, x turns at 0.7 of it (default 90)
+//   -S samples    samples per voxel edge (default 4, 64 per voxel)
+//   -t threshold  coverage a voxel is lit from (default 0.5)
+//   -f format     raw     - 64 byte frames in the legacy frame layout (as fx888)
+//                 gray    - 512 bytes a frame, coverage 0..255, z, y, x order
+//                 packets - frame packets (cubelink.h) for the serial line
+//                 (default raw)
+//   -j threads    render threads (default: all cores)
+//   -o out        output file, default stdout
+//
+// The render time and the rate against real time go to stderr.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cubelink.h"
+
+static const double PI = 3.14159265358979323846;
+
+struct Vec3 {
+    double x, y, z;
+};
+
+static double length(Vec3 a) { return std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z); }
+
+// turn about z by a, then about x by b
+static Vec3 turn(Vec3 p, double a, double b)
+{
+    double c = std::cos(a), s = std::sin(a);
+    p = {c * p.x - s * p.y, s * p.x + c * p.y, p.z};
+    c = std::cos(b), s = std::sin(b);
+    return {p.x, c * p.y - s * p.z, s * p.y + c * p.z};
+}
+
+// the inverse of turn()
+static Vec3 unturn(Vec3 p, double a, double b)
+{
+    double c = std::cos(-b), s = std::sin(-b);
+    p = {p.x, c * p.y - s * p.z, s * p.y + c * p.z};
+    c = std::cos(-a), s = std::sin(-a);
+    return {c * p.x - s * p.y, s * p.x + c * p.y, p.z};
+}
+
+///////////////////////////////////////////////////////////
+// shapes in cube coordinates -1..1, negative inside
+static double sphere(Vec3 p)
+{
+    return length(p) - 0.9;
+}
+
+static double box(Vec3 p)
+{
+    Vec3 q = {std::fabs(p.x) - 0.6, std::fabs(p.y) - 0.6, std::fabs(p.z) - 0.6};
+    Vec3 out = {std::max(q.x, 0.0), std::max(q.y, 0.0), std::max(q.z, 0.0)};
+    return length(out) + std::min(std::max(q.x, std::max(q.y, q.z)), 0.0);
+}
+
+static double torus(Vec3 p)
+{
+    double ring = std::sqrt(p.x * p.x + p.y * p.y) - 0.6;
+    return std::sqrt(ring * ring + p.z * p.z) - 0.3;
+}
+
+enum Scene { SPHERE, BOX, TORUS, MORPH };
+
+static double sdf(Scene scene, Vec3 p, double t)
+{
+    static double (*const shapes[3])(Vec3) = {sphere, box, torus};
+    if (scene != MORPH)
+        return shapes[scene](p);
+    // eased blend of the distances, a second per shape
+    unsigned a = unsigned(t) % 3, b = (a + 1) % 3;
+    double s = t - std::floor(t);
+    s = 0.5 - 0.5 * std::cos(PI * s);
+    return shapes[a](p) * (1 - s) + shapes[b](p) * s;
+}
+
+///////////////////////////////////////////////////////////
+// OBJ mesh: vertices and triangles (polygons as fans), scaled into -1..1
+struct Mesh {
+    std::vector<Vec3> v;
+    std::vector<unsigned> tri;          // 3 vertex indexes a triangle
+
+    bool load(const std::string &name, std::string &error)
+    {
+        std::ifstream f(name);
+        if (!f) {
+            error = "cannot read " + name;
+            return false;
+        }
+        std::string line;
+        for (unsigned n = 1; std::getline(f, line); n++) {
+            std::istringstream s(line);
+            std::string key;
+            s >> key;
+            if (key == "v") {
+                Vec3 p;
+                if (!(s >> p.x >> p.y >> p.z)) {
+                    error = name + ":" + std::to_string(n) + ": bad vertex";
+                    return false;
+                }
+                v.push_back(p);
+            }
+            else if (key == "f") {
+                std::vector<unsigned> poly;
+                std::string ref;
+                while (s >> ref) {             // v, v/vt, v//vn or v/vt/vn
+                    long i = std::atol(ref.c_str());
+                    if (i < 0)
+                        i += (long)v.size() + 1;
+                    if (i < 1 || i > (long)v.size()) {
+                        error = name + ":" + std::to_string(n) + ": bad face";
+                        return false;
+                    }
+                    poly.push_back(unsigned(i - 1));
+                }
+                for (size_t k = 2; k < poly.size(); k++)
+                    tri.insert(tri.end(), {poly[0], poly[k - 1], poly[k]});
+            }
+        }
+        if (tri.empty()) {
+            error = name + ": no faces";
+            return false;
+        }
+        // centre, scale the longest side to 2 and turn y up into z up
+        Vec3 lo = v[0], hi = v[0];
+        for (const Vec3 &p : v) {
+            lo = {std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z)};
+            hi = {std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z)};
+        }
+        double size = std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z, 1e-9});
+        for (Vec3 &p : v) {
+            Vec3 c = {(p.x - (lo.x + hi.x) / 2) * 2 / size, (p.y - (lo.y + hi.y) / 2) * 2 / size,
+                      (p.z - (lo.z + hi.z) / 2) * 2 / size};
+            p = {c.x, -c.z, c.y};
+        }
+        return true;
+    }
+};
+
+///////////////////////////////////////////////////////////
+// coverage of the 512 voxels, z, y, x order, 0..1
+typedef std::vector<float> Coverage;
+
+static double cube_coord(unsigned voxel, unsigned k, unsigned samples)
+{
+    return ((voxel + (k + 0.5) / samples) - 4) / 4;     // sample centre, -1..1
+}
+
+static void render_sdf(Coverage &c, Scene scene, double t, double a, double b, unsigned samples)
+{
+    double share = 1.0 / (samples * samples * samples);
+    for (unsigned z = 0; z < 8; z++)
+        for (unsigned y = 0; y < 8; y++)
+            for (unsigned x = 0; x < 8; x++) {
+                unsigned inside = 0;
+                for (unsigned kz = 0; kz < samples; kz++)
+                    for (unsigned ky = 0; ky < samples; ky++)
+                        for (unsigned kx = 0; kx < samples; kx++) {
+                            Vec3 p = {cube_coord(x, kx, samples), cube_coord(y, ky, samples),
+                                      cube_coord(z, kz, samples)};
+                            inside += sdf(scene, unturn(p, a, b), t) < 0;
+                        }
+                c[(z * 8 + y) * 8 + x] = float(inside * share);
+            }
+}
+
+// inside = an odd number of surface crossings along the sample line in x
+static void render_mesh(Coverage &c, const Mesh &mesh, double a, double b, unsigned samples)
+{
+    std::vector<Vec3> v(mesh.v.size());
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = turn(mesh.v[i], a, b);
+    std::fill(c.begin(), c.end(), 0.0f);
+    float share = 1.0f / (samples * samples * samples);
+    std::vector<double> hits;
+    for (unsigned z = 0; z < 8; z++)
+        for (unsigned kz = 0; kz < samples; kz++)
+            for (unsigned y = 0; y < 8; y++)
+                for (unsigned ky = 0; ky < samples; ky++) {
+                    // off the sample grid by a hair, so a line does not run
+                    // through an edge shared by two triangles
+                    double py = cube_coord(y, ky, samples) + 1.3e-7, pz = cube_coord(z, kz, samples) + 0.7e-7;
+                    hits.clear();
+                    for (size_t i = 0; i < mesh.tri.size(); i += 3) {
+                        const Vec3 &p0 = v[mesh.tri[i]], &p1 = v[mesh.tri[i + 1]], &p2 = v[mesh.tri[i + 2]];
+                        // barycentric coordinates of (py, pz) in the triangle seen along x
+                        double d = (p1.y - p0.y) * (p2.z - p0.z) - (p2.y - p0.y) * (p1.z - p0.z);
+                        if (d == 0)
+                            continue;
+                        double u = ((py - p0.y) * (p2.z - p0.z) - (p2.y - p0.y) * (pz - p0.z)) / d;
+                        double w = ((p1.y - p0.y) * (pz - p0.z) - (py - p0.y) * (p1.z - p0.z)) / d;
+                        if (u < 0 || w < 0 || u + w > 1)
+                            continue;
+                        hits.push_back(p0.x + u * (p1.x - p0.x) + w * (p2.x - p0.x));
+                    }
+                    std::sort(hits.begin(), hits.end());
+                    for (unsigned x = 0; x < 8; x++)
+                        for (unsigned kx = 0; kx < samples; kx++) {
+                            double px = cube_coord(x, kx, samples);
+                            size_t before = std::lower_bound(hits.begin(), hits.end(), px) - hits.begin();
+                            if (before & 1)
+                                c[(z * 8 + y) * 8 + x] += share;
+                        }
+                }
+}
+
+static Frame threshold(const Coverage &c, float level)
+{
+    Frame f{};
+    for (unsigned i = 0; i < 512; i++)
+        if (c[i] >= level)
+            f[i / 8] |= 1 << (i % 8);
+    return f;
+}
+
+static const char usage[] =
+    "usage: cubevox [-s sphere|box|torus|morph | -m mesh.obj] [-n frames] [-r fps] [-w deg/s]\n"
+    "               [-S samples] [-t threshold] [-f raw|gray|packets] [-j threads] [-o out]\n";
+
+int main(int argc, char **argv)
+{
+    Scene scene = MORPH;
+    std::string mesh_name, format = "raw", out_name;
+    unsigned frames = 120, samples = 4, threads = std::thread::hardware_concurrency();
+    double fps = 30, turn_rate = 90, level = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-s" && i + 1 < argc) {
+            std::string s = argv[++i];
+            const char *names[] = {"sphere", "box", "torus", "morph"};
+            auto it = std::find(std::begin(names), std::end(names), s);
+            if (it == std::end(names)) {
+                std::cerr << usage;
+                return 1;
+            }
+            scene = Scene(it - std::begin(names));
+        }
+        else if (arg == "-m" && i + 1 < argc)
+            mesh_name = argv[++i];
+        else if (arg == "-n" && i + 1 < argc)
+            frames = std::atoi(argv[++i]);
+        else if (arg == "-r" && i + 1 < argc)
+            fps = std::atof(argv[++i]);
+        else if (arg == "-w" && i + 1 < argc)
+            turn_rate = std::atof(argv[++i]);
+        else if (arg == "-S" && i + 1 < argc)
+            samples = std::atoi(argv[++i]);
+        else if (arg == "-t" && i + 1 < argc)
+            level = std::atof(argv[++i]);
+        else if (arg == "-f" && i + 1 < argc)
+            format = argv[++i];
+        else if (arg == "-j" && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+    if (fps <= 0 || samples == 0 || samples > 64 || (format != "raw" && format != "gray" && format != "packets")) {
+        std::cerr << usage;
+        return 1;
+    }
+    if (threads == 0)
+        threads = 1;
+
+    Mesh mesh;
+    std::string error;
+    if (!mesh_name.empty() && !mesh.load(mesh_name, error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    // every thread takes the next frame not taken yet
+    std::vector<Coverage> cover(frames, Coverage(512));
+    std::atomic<unsigned> next(0);
+    auto t0 = std::chrono::steady_clock::now();
+    auto work = [&] {
+        for (unsigned n; (n = next++) < frames;) {
+            double t = n / fps, a = t * turn_rate * PI / 180, b = a * 0.7;
+            if (mesh_name.empty())
+                render_sdf(cover[n], scene, t, a, b, samples);
+            else
+                render_mesh(cover[n], mesh, a, b, samples);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned k = 1; k < threads; k++)
+        pool.emplace_back(work);
+    work();
+    for (std::thread &th : pool)
+        th.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::vector<unsigned char> out;
+    for (const Coverage &c : cover) {
+        if (format == "gray")
+            for (float v : c)
+                out.push_back((unsigned char)std::lround(v * 255));
+        else if (format == "raw") {
+            Frame f = threshold(c, level);
+            out.insert(out.end(), f.begin(), f.end());
+        }
+        else
+            frame_packet(out, threshold(c, level));
+    }
+    std::ofstream file;
+    if (!out_name.empty()) {
+        file.open(out_name, std::ios::binary);
+        if (!file) {
+            std::cerr << "cannot write " << out_name << "\n";
+            return 1;
+        }
+    }
+    std::ostream &os = out_name.empty() ? std::cout : file;
+    os.write(reinterpret_cast<const char *>(out.data()), out.size());
+
+    std::fprintf(stderr, "%u frames, %u samples a voxel, %u threads: %.3f s, %.1f frames/s (%.1fx real time at %.0f fps)\n",
+                 frames, samples * samples * samples, threads, secs, frames / secs, frames / secs / fps, fps);
+    return 0;
+}
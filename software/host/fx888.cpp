@@ -0,0 +1,130 @@
+// fx888 - runs the effects of firmware/888.c natively and records what the
+// cube shows as a raw frame stream: 64 byte frames in the legacy serial
+// layout (display[z][y], bit x = LED x), sampled at a fixed frame rate.
+//
+// usage: fx888 [-e list] [-r fps] [-u us] [-o out.raw]
+//
+//   -e list   comma separated effects, 1..11 = flash_N(), 0 = clear(0)
+//             (default: the play list of main() in 888.c)
+//   -r fps    sample rate of the stream (default 61, one per cube refresh)
+//   -u us     length of one delay() unit in microseconds (default 5)
+//
+// Time only passes inside delay(); the drawing code and the refresh
+// interrupt are treated as free, so the stream follows the nominal timing.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+extern unsigned char display[8][8];
+void clear(char le);
+void flash_1();
+void flash_2();
+void flash_3();
+void flash_4();
+void flash_5();
+void flash_6();
+void flash_7();
+void flash_8();
+void flash_9();
+void flash_10();
+void flash_11();
+}
+
+static void (*const effects[])() = {
+    nullptr, flash_1, flash_2, flash_3, flash_4, flash_5, flash_6,
+    flash_7, flash_8, flash_9, flash_10, flash_11
+};
+
+static const char play_list[] = "0,2,3,4,4,5,5,6,7,8,9,10,0,11,9,5,7,5,6,8,9,10";
+
+static std::ostream *out;
+static uint64_t fps = 61;
+static uint64_t unit_us = 5;
+static uint64_t now = 0;        // delay units since start
+static uint64_t frames = 0;     // frames written
+
+///////////////////////////////////////////////////////////
+// the only clock of the effects: hold the cube for i units
+extern "C" void delay(unsigned int i)
+{
+    now += i;
+    // frame n is sampled at n / fps seconds
+    while (frames * 1000000 < now * unit_us * fps) {
+        out->write(reinterpret_cast<const char *>(display), 64);
+        frames++;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string list = play_list, out_name;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-e" && i + 1 < argc)
+            list = argv[++i];
+        else if (arg == "-r" && i + 1 < argc)
+            fps = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "-u" && i + 1 < argc)
+            unit_us = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "-o" && i + 1 < argc)
+            out_name = argv[++i];
+        else {
+            std::cerr << "usage: fx888 [-e list] [-r fps] [-u us] [-o out.raw]\n";
+            return 1;
+        }
+    }
+    if (fps == 0 || unit_us == 0) {
+        std::cerr << "fx888: -r and -u must be positive\n";
+        return 1;
+    }
+
+    std::vector<int> run;
+    std::istringstream items(list);
+    for (std::string item; std::getline(items, item, ',');) {
+        char *end;
+        long n = std::strtol(item.c_str(), &end, 10);
+        if (item.empty() || *end || n < 0 || n > 11) {
+            std::cerr << "fx888: bad effect '" << item << "'\n";
+            return 1;
+        }
+        run.push_back(int(n));
+    }
+
+    std::ofstream file;
+    if (out_name.empty()) {
+        out = &std::cout;
+    }
+    else {
+        file.open(out_name, std::ios::binary);
+        out = &file;
+    }
+
+    std::fprintf(stderr, "%-10s %8s %10s\n", "effect", "frames", "seconds");
+    for (int n : run) {
+        uint64_t first = frames;
+        if (n == 0)
+            clear(0);
+        else
+            effects[n]();
+        std::fprintf(stderr, "%-10s %8llu %10.2f\n",
+                     n ? ("flash_" + std::to_string(n)).c_str() : "clear",
+                     (unsigned long long)(frames - first), double(frames - first) / fps);
+    }
+    std::fprintf(stderr, "%-10s %8llu %10.2f\n", "total",
+                 (unsigned long long)frames, double(frames) / fps);
+
+    out->flush();
+    if (!*out) {
+        std::cerr << "cannot write " << (out_name.empty() ? "stdout" : out_name) << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+// fxgold - regression check of the effects of firmware/888.c: runs every
+// flash_N() natively from a cleared cube, records the pictures it shows with
+// their virtual times and compares them with the golden files, so changes
+// to point(), cirp(), line(), box() and the rest can be checked for changed
+// pictures and changed timing.
+//
+// usage: fxgold [-u] [-d dir] [-e list]
+//
+//   -u        write the golden files from this build instead of checking
+//   -d dir    golden files (default golden)
+//   -e list   comma separated effects 1..11 (default all)
+//
+// Time is counted in delay() units as in fx888. Every delay() is a point
+// where the cube shows display[][] (the refresh interrupt runs meanwhile);
+// delays showing the same picture in a row are one step. A golden file
+// (dir/flash_N.gold) holds one step a line:
+//
+//   <start> <units> <fnv1a64 of the 64 display bytes, hex>
+//
+// Checked against it: the pictures in order (the first one that differs,
+// or the first missing / extra one) and, where the pictures agree, how long
+// every step is held (the first step held differently and the change of the
+// total time). Exit status 1 if any effect differs or has no golden file.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+extern unsigned char display[8][8];
+void clear(char le);
+void flash_1();
+void flash_2();
+void flash_3();
+void flash_4();
+void flash_5();
+void flash_6();
+void flash_7();
+void flash_8();
+void flash_9();
+void flash_10();
+void flash_11();
+}
+
+static void (*const effects[])() = {
+    nullptr, flash_1, flash_2, flash_3, flash_4, flash_5, flash_6,
+    flash_7, flash_8, flash_9, flash_10, flash_11
+};
+
+static const double UNIT_US = 5;   // a delay() unit, as fx888 -u
+
+struct Step {
+    uint64_t start, units, hash;
+};
+
+static std::vector<Step> steps;
+static uint64_t now = 0;            // delay units since the effect started
+
+static uint64_t fnv1a(const unsigned char *p, size_t n)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ p[i]) * 0x100000001b3ull;
+    return h;
+}
+
+///////////////////////////////////////////////////////////
+// the only clock of the effects: the cube shows display for i units
+extern "C" void delay(unsigned int i)
+{
+    uint64_t h = fnv1a(&display[0][0], 64);
+    if (!steps.empty() && steps.back().hash == h)
+        steps.back().units += i;
+    else
+        steps.push_back({now, i, h});
+    now += i;
+}
+
+static std::vector<Step> run(int n)
+{
+    steps.clear();
+    now = 0;
+    clear(0);
+    effects[n]();
+    return steps;
+}
+
+static std::string gold_name(const std::string &dir, int n)
+{
+    return dir + "/flash_" + std::to_string(n) + ".gold";
+}
+
+static bool load(const std::string &name, std::vector<Step> &out)
+{
+    std::ifstream f(name);
+    if (!f)
+        return false;
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream fields(line);
+        Step s;
+        std::string hash;
+        if (!(fields >> s.start >> s.units >> hash))
+            return false;
+        s.hash = std::strtoull(hash.c_str(), nullptr, 16);
+        out.push_back(s);
+    }
+    return true;
+}
+
+static bool save(const std::string &name, int n, const std::vector<Step> &s)
+{
+    FILE *f = std::fopen(name.c_str(), "w");
+    if (!f)
+        return false;
+    std::fprintf(f, "# flash_%d of firmware/888.c, written by fxgold -u: start units hash\n", n);
+    for (const Step &st : s)
+        std::fprintf(f, "%llu %llu %016llx\n", (unsigned long long)st.start, (unsigned long long)st.units,
+                     (unsigned long long)st.hash);
+    return std::fclose(f) == 0;
+}
+
+static double ms(uint64_t units)
+{
+    return units * UNIT_US / 1000;
+}
+
+// prints what differs, false if anything does
+static bool compare(int n, const std::vector<Step> &got, const std::vector<Step> &gold)
+{
+    size_t k = 0;
+    while (k < got.size() && k < gold.size() && got[k].hash == gold[k].hash)
+        k++;
+    bool pictures = k == got.size() && k == gold.size();
+    if (!pictures) {
+        if (k < got.size() && k < gold.size())
+            std::printf("flash_%d: picture %zu of %zu differs (%016llx, golden %016llx) at %.1f ms\n", n, k,
+                        gold.size(), (unsigned long long)got[k].hash, (unsigned long long)gold[k].hash,
+                        ms(got[k].start));
+        else if (k < gold.size())
+            std::printf("flash_%d: ends after %zu of %zu pictures at %.1f ms\n", n, k, gold.size(), ms(now));
+        else
+            std::printf("flash_%d: %zu pictures more than the %zu golden ones, the first at %.1f ms\n", n,
+                        got.size() - k, gold.size(), ms(got[k].start));
+    }
+
+    // timing of the steps whose pictures agree
+    size_t held = 0, first = k;
+    for (size_t i = 0; i < k; i++)
+        if (got[i].units != gold[i].units && held++ == 0)
+            first = i;
+    uint64_t total = gold.empty() ? 0 : gold.back().start + gold.back().units;
+    if (held)
+        std::printf("flash_%d: %zu steps held differently, the first: picture %zu at %.1f ms held %.3f ms "
+                    "(golden %.3f ms); total %.1f ms (golden %.1f ms, %+.2f%%)\n",
+                    n, held, first, ms(got[first].start), ms(got[first].units), ms(gold[first].units), ms(now),
+                    ms(total), total ? (double(now) / total - 1) * 100 : 0.0);
+    if (pictures && !held)
+        std::printf("flash_%d: ok, %zu pictures, %.1f ms\n", n, got.size(), ms(now));
+    return pictures && !held;
+}
+
+static const char usage[] = "usage: fxgold [-u] [-d dir] [-e list]\n";
+
+int main(int argc, char **argv)
+{
+    bool update = false;
+    std::string dir = "golden", list = "1,2,3,4,5,6,7,8,9,10,11";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-u")
+            update = true;
+        else if (arg == "-d" && i + 1 < argc)
+            dir = argv[++i];
+        else if (arg == "-e" && i + 1 < argc)
+            list = argv[++i];
+        else {
+            std::cerr << usage;
+            return 1;
+        }
+    }
+
+    std::vector<int> run_list;
+    std::istringstream items(list);
+    for (std::string item; std::getline(items, item, ',');) {
+        char *end;
+        long n = std::strtol(item.c_str(), &end, 10);
+        if (item.empty() || *end || n < 1 || n > 11) {
+            std::cerr << "fxgold: bad effect '" << item << "'\n";
+            return 1;
+        }
+        run_list.push_back(int(n));
+    }
+
+    int status = 0;
+    for (int n : run_list) {
+        std::vector<Step> got = run(n);
+        std::string name = gold_name(dir, n);
+        if (update) {
+            if (!save(name, n, got)) {
+                std::cerr << "cannot write " << name << "\n";
+                return 1;
+            }
+            std::printf("flash_%d: %zu pictures, %.1f ms -> %s\n", n, got.size(), ms(now), name.c_str());
+            continue;
+        }
+        std::vector<Step> gold;
+        if (!load(name, gold)) {
+            std::printf("flash_%d: cannot read %s (fxgold -u writes it)\n", n, name.c_str());
+            status = 1;
+        }
+        else if (!compare(n, got, gold))
+            status = 1;
+    }
+    return status;
+}
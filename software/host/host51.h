@@ -0,0 +1,18 @@
+// Stand-in for <REG52.H>/<intrins.h> so the Keil firmware sources build
+// natively (-DHOST_BUILD) and the host tools can run their effects.
+// delay() is supplied by the tool: it is the only place time passes.
+#ifndef HOST51_H
+#define HOST51_H
+
+#define code const
+#define bit unsigned char
+#define abs cube_abs  // 888.c rounds with its own abs()
+
+// written by the firmware and never read here; unused ones must not warn
+__attribute__((unused)) static unsigned char P0, P1, P2, IE, TCON, TH0, TL0, TR0;
+
+static inline void _nop_(void) {}
+
+void delay(unsigned int i);
+
+#endif
@@ -0,0 +1,28 @@
+// Stand-in for <mcs51/stc12.h> and the SDCC keywords so the v2 firmware
+// (firmware/v2-sdcc/firmware.c) builds natively (-DHOST_BUILD) and cubesim
+// can run it. The special function registers are plain variables owned by
+// the simulator; the interrupt functions are called by it, main() becomes
+// cube_main(). idle(), delay5us() and host_iap() are supplied by the
+// simulator (the firmware calls host_iap() after triggering an IAP
+// command): time only passes there. The frame kernels are always the C
+// loops here, FB_ASM or not.
+#ifndef HOSTSDCC_H
+#define HOSTSDCC_H
+
+#define __xdata
+#define __idata
+#define __data
+#define __code const
+#define __bit unsigned char
+#define __interrupt(n)
+#define __asm__(s) ((void)0)
+
+#define main cube_main
+
+extern volatile unsigned char P0, P1, P2, PCON, SCON, SBUF, AUXR, AUXR1, BRT, TMOD, TH0, TL0, TH1, TL1;
+extern volatile unsigned char IAP_DATA, IAP_ADDRH, IAP_ADDRL, IAP_CMD, IAP_TRIG, IAP_CONTR;
+extern volatile unsigned char EA, ES, ET0, TR0, TF0, TR1, RI, TI;
+
+void host_iap(void);
+
+#endif
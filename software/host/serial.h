@@ -0,0 +1,89 @@
+// serial.h - the serial port plumbing of the host tools that talk to a cube
+// (or cubeemu) directly: line rates, raw mode for ttys and ptys, whole
+// writes, the monotonic clock and the stop flag SIGINT/SIGTERM set.
+#ifndef SERIAL_H
+#define SERIAL_H
+
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <termios.h>
+#include <unistd.h>
+
+inline volatile sig_atomic_t stop = 0;  // set by on_signal()
+
+inline void on_signal(int)
+{
+    stop = 1;
+}
+
+inline uint64_t clock_ns(clockid_t id = CLOCK_MONOTONIC)
+{
+    timespec ts;
+    clock_gettime(id, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000u + ts.tv_nsec;
+}
+
+// CLOCK_MONOTONIC in seconds
+inline double now_s()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+///////////////////////////////////////////////////////////
+// the line rates a cube runs at, B0 / 0 for any other
+inline speed_t bps_speed(unsigned bps)
+{
+    switch (bps) {
+    case 1200: return B1200;
+    case 2400: return B2400;
+    case 4800: return B4800;
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    }
+    return B0;
+}
+
+inline unsigned speed_bps(speed_t s)
+{
+    for (unsigned bps : {1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200, 230400})
+        if (bps_speed(bps) == s)
+            return bps;
+    return 0;
+}
+
+// raw mode at bps, for ttys and ptys alike; false if fd is not a tty
+inline bool make_raw(int fd, unsigned bps)
+{
+    termios tio;
+    if (tcgetattr(fd, &tio) != 0)
+        return false;
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, bps_speed(bps));
+    cfsetospeed(&tio, bps_speed(bps));
+    return tcsetattr(fd, TCSANOW, &tio) == 0;
+}
+
+inline bool write_all(int fd, const unsigned char *p, size_t n)
+{
+    while (n) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0 && errno == EINTR)
+            continue;
+        if (w <= 0)
+            return false;
+        p += w;
+        n -= w;
+    }
+    return true;
+}
+
+#endif
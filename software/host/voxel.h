@@ -0,0 +1,320 @@
+// voxel.h - an 8x8x8 cube as one 64 byte (512 bit) value in the layout of
+// the firmware's display[z][y]: byte z * 8 + y is a row, bit x = LED x. A
+// VoxelCube is the payload of a frame packet as it is, no conversion.
+//
+// Batch kernels work on arrays of cubes: vox_or/and/xor/popcount pick the
+// widest path the compiler targets (-mavx2, SSE2 on every x86-64), the
+// _scalar versions are kept for comparison (see voxelbench.cpp).
+// Rotations are quarter turns done with 8x8 bit matrix transposes:
+//
+//   'z'  (x, y, z) -> (7 - y, x, z)    per layer, one transpose
+//   'y'  (x, y, z) -> (z, y, 7 - x)    per y slice, slices by a byte transpose
+//   'x'  (x, y, z) -> (x, 7 - z, y)    rows move whole, one byte transpose
+#ifndef VOXEL_H
+#define VOXEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__clang__)
+#define VOX_SCALAR
+#define VOX_NOVEC _Pragma("clang loop vectorize(disable)")
+#elif defined(__GNUC__)
+#define VOX_SCALAR __attribute__((optimize("no-tree-vectorize")))
+#define VOX_NOVEC
+#else
+#define VOX_SCALAR
+#define VOX_NOVEC
+#endif
+
+struct alignas(64) VoxelCube {
+    uint8_t rows[64];
+
+    constexpr VoxelCube() : rows{} {}
+
+    constexpr bool get(unsigned x, unsigned y, unsigned z) const
+    {
+        return (rows[z * 8 + y] >> x) & 1;
+    }
+
+    constexpr void set(unsigned x, unsigned y, unsigned z, bool on)
+    {
+        if (on)
+            rows[z * 8 + y] |= uint8_t(1u << x);
+        else
+            rows[z * 8 + y] &= uint8_t(~(1u << x));
+    }
+
+    // layer z as an 8x8 bit matrix: byte y, bit x
+    constexpr uint64_t layer(unsigned z) const
+    {
+#if defined(__GNUC__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        if (!__builtin_is_constant_evaluated()) {
+            uint64_t v = 0;
+            __builtin_memcpy(&v, rows + z * 8, 8);
+            return v;
+        }
+#endif
+        uint64_t v = 0;
+        for (unsigned y = 0; y < 8; y++)
+            v |= uint64_t(rows[z * 8 + y]) << (8 * y);
+        return v;
+    }
+
+    constexpr void set_layer(unsigned z, uint64_t v)
+    {
+#if defined(__GNUC__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        if (!__builtin_is_constant_evaluated()) {
+            __builtin_memcpy(rows + z * 8, &v, 8);
+            return;
+        }
+#endif
+        for (unsigned y = 0; y < 8; y++)
+            rows[z * 8 + y] = uint8_t(v >> (8 * y));
+    }
+
+    constexpr bool operator==(const VoxelCube &o) const
+    {
+        for (unsigned i = 0; i < 64; i++)
+            if (rows[i] != o.rows[i])
+                return false;
+        return true;
+    }
+    constexpr bool operator!=(const VoxelCube &o) const { return !(*this == o); }
+
+    const unsigned char *data() const { return rows; }
+    unsigned char *data() { return rows; }
+};
+
+static_assert(sizeof(VoxelCube) == 64, "a cube is one 64 byte frame");
+
+///////////////////////////////////////////////////////////
+// 8x8 bit matrix transpose, byte r bit c <-> byte c bit r
+constexpr uint64_t transpose8(uint64_t x)
+{
+    uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+    x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+    x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+    return x ^ t ^ (t << 28);
+}
+
+///////////////////////////////////////////////////////////
+// reverse the bits of every byte (mirror x)
+constexpr uint64_t mirror8(uint64_t x)
+{
+    x = (x & 0xF0F0F0F0F0F0F0F0ull) >> 4 | (x & 0x0F0F0F0F0F0F0F0Full) << 4;
+    x = (x & 0xCCCCCCCCCCCCCCCCull) >> 2 | (x & 0x3333333333333333ull) << 2;
+    return (x & 0xAAAAAAAAAAAAAAAAull) >> 1 | (x & 0x5555555555555555ull) << 1;
+}
+
+///////////////////////////////////////////////////////////
+// 8x8 byte matrix transpose of 8 words, byte c of m[r] <-> byte r of m[c]
+constexpr void transpose_bytes(uint64_t *m)
+{
+    for (unsigned i = 0; i < 8; i += 2) {
+        uint64_t t = ((m[i] >> 8) ^ m[i + 1]) & 0x00FF00FF00FF00FFull;
+        m[i + 1] ^= t;
+        m[i] ^= t << 8;
+    }
+    for (unsigned i = 0; i < 8; i += (i & 1) ? 3 : 1) {
+        uint64_t t = ((m[i] >> 16) ^ m[i + 2]) & 0x0000FFFF0000FFFFull;
+        m[i + 2] ^= t;
+        m[i] ^= t << 16;
+    }
+    for (unsigned i = 0; i < 4; i++) {
+        uint64_t t = ((m[i] >> 32) ^ m[i + 4]) & 0x00000000FFFFFFFFull;
+        m[i + 4] ^= t;
+        m[i] ^= t << 32;
+    }
+}
+
+constexpr uint64_t reverse_bytes(uint64_t x)
+{
+    x = (x & 0xFFFFFFFF00000000ull) >> 32 | (x & 0x00000000FFFFFFFFull) << 32;
+    x = (x & 0xFFFF0000FFFF0000ull) >> 16 | (x & 0x0000FFFF0000FFFFull) << 16;
+    return (x & 0xFF00FF00FF00FF00ull) >> 8 | (x & 0x00FF00FF00FF00FFull) << 8;
+}
+
+///////////////////////////////////////////////////////////
+// quarter turns, see the table at the top
+constexpr VoxelCube rotate_z(const VoxelCube &c)
+{
+    VoxelCube r;
+    for (unsigned z = 0; z < 8; z++)
+        r.set_layer(z, mirror8(transpose8(c.layer(z))));
+    return r;
+}
+
+constexpr VoxelCube rotate_y(const VoxelCube &c)
+{
+    uint64_t m[8] = {};
+    for (unsigned z = 0; z < 8; z++)
+        m[z] = c.layer(z);
+    transpose_bytes(m);             // m[y]: slice y, byte z bit x
+    for (unsigned y = 0; y < 8; y++)
+        m[y] = reverse_bytes(transpose8(m[y]));
+    transpose_bytes(m);
+    VoxelCube r;
+    for (unsigned z = 0; z < 8; z++)
+        r.set_layer(z, m[z]);
+    return r;
+}
+
+constexpr VoxelCube rotate_x(const VoxelCube &c)
+{
+    uint64_t m[8] = {};
+    for (unsigned z = 0; z < 8; z++)
+        m[z] = c.layer(7 - z);
+    transpose_bytes(m);             // new row (z, y) = old row (7 - y, z)
+    VoxelCube r;
+    for (unsigned z = 0; z < 8; z++)
+        r.set_layer(z, m[z]);
+    return r;
+}
+
+// rotation by get/set only, the reference for the transposes
+inline VoxelCube rotate_ref(const VoxelCube &c, char axis)
+{
+    VoxelCube r;
+    for (unsigned z = 0; z < 8; z++)
+        for (unsigned y = 0; y < 8; y++)
+            for (unsigned x = 0; x < 8; x++) {
+                if (!c.get(x, y, z))
+                    continue;
+                if (axis == 'z')
+                    r.set(7 - y, x, z, true);
+                else if (axis == 'y')
+                    r.set(z, y, 7 - x, true);
+                else
+                    r.set(x, 7 - z, y, true);
+            }
+    return r;
+}
+
+///////////////////////////////////////////////////////////
+// batch rotation: dst[i] = src[i] turned by quarter turns about axis
+inline void vox_rotate(VoxelCube *dst, const VoxelCube *src, size_t n, char axis, int turns)
+{
+    turns &= 3;
+    for (size_t i = 0; i < n; i++) {
+        VoxelCube c = src[i];
+        for (int t = 0; t < turns; t++)
+            c = axis == 'z' ? rotate_z(c) : axis == 'y' ? rotate_y(c) : rotate_x(c);
+        dst[i] = c;
+    }
+}
+
+///////////////////////////////////////////////////////////
+// scalar kernels, 64 bits at a time
+
+#define VOX_SCALAR_OP(name, op)                                                     \
+    VOX_SCALAR inline void name(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) \
+    {                                                                               \
+        VOX_NOVEC                                                                   \
+        for (size_t i = 0; i < n * 8; i++) {                                        \
+            uint64_t x, y;                                                          \
+            std::memcpy(&x, a->rows + i * 8, 8);                                    \
+            std::memcpy(&y, b->rows + i * 8, 8);                                    \
+            x = x op y;                                                             \
+            std::memcpy(dst->rows + i * 8, &x, 8);                                  \
+        }                                                                           \
+    }
+
+VOX_SCALAR_OP(vox_or_scalar, |)
+VOX_SCALAR_OP(vox_and_scalar, &)
+VOX_SCALAR_OP(vox_xor_scalar, ^)
+
+// lit voxels of every cube
+VOX_SCALAR inline void vox_popcount_scalar(uint32_t *count, const VoxelCube *a, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint32_t c = 0;
+        VOX_NOVEC
+        for (unsigned k = 0; k < 8; k++) {
+            uint64_t x;
+            std::memcpy(&x, a[i].rows + k * 8, 8);
+            c += __builtin_popcountll(x);
+        }
+        count[i] = c;
+    }
+}
+
+///////////////////////////////////////////////////////////
+// SIMD kernels: two 256 bit or four 128 bit ops per cube
+
+#if defined(__AVX2__)
+
+#define VOX_SIMD_OP(name, intrin)                                                   \
+    inline void name(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) \
+    {                                                                               \
+        for (size_t i = 0; i < n * 2; i++) {                                        \
+            __m256i x = _mm256_load_si256(reinterpret_cast<const __m256i *>(a->rows) + i); \
+            __m256i y = _mm256_load_si256(reinterpret_cast<const __m256i *>(b->rows) + i); \
+            _mm256_store_si256(reinterpret_cast<__m256i *>(dst->rows) + i, intrin(x, y)); \
+        }                                                                           \
+    }
+
+VOX_SIMD_OP(vox_or, _mm256_or_si256)
+VOX_SIMD_OP(vox_and, _mm256_and_si256)
+VOX_SIMD_OP(vox_xor, _mm256_xor_si256)
+
+// nibble lookup popcount (vpshufb), bytes summed with vpsadbw
+inline void vox_popcount(uint32_t *count, const VoxelCube *a, size_t n)
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    for (size_t i = 0; i < n; i++) {
+        const __m256i *p = reinterpret_cast<const __m256i *>(a[i].rows);
+        __m256i sum = _mm256_setzero_si256();
+        for (int k = 0; k < 2; k++) {
+            __m256i v = _mm256_load_si256(p + k);
+            __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low));
+            __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+            sum = _mm256_add_epi8(sum, _mm256_add_epi8(lo, hi));
+        }
+        sum = _mm256_sad_epu8(sum, _mm256_setzero_si256());
+        __m128i s = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        count[i] = uint32_t(_mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1));
+    }
+}
+
+#elif defined(__SSE2__)
+
+#define VOX_SIMD_OP(name, intrin)                                                   \
+    inline void name(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) \
+    {                                                                               \
+        for (size_t i = 0; i < n * 4; i++) {                                        \
+            __m128i x = _mm_load_si128(reinterpret_cast<const __m128i *>(a->rows) + i); \
+            __m128i y = _mm_load_si128(reinterpret_cast<const __m128i *>(b->rows) + i); \
+            _mm_store_si128(reinterpret_cast<__m128i *>(dst->rows) + i, intrin(x, y)); \
+        }                                                                           \
+    }
+
+VOX_SIMD_OP(vox_or, _mm_or_si128)
+VOX_SIMD_OP(vox_and, _mm_and_si128)
+VOX_SIMD_OP(vox_xor, _mm_xor_si128)
+
+// no byte shuffle in SSE2: popcount stays 64 bits at a time
+inline void vox_popcount(uint32_t *count, const VoxelCube *a, size_t n)
+{
+    vox_popcount_scalar(count, a, n);
+}
+
+#else
+
+inline void vox_or(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) { vox_or_scalar(dst, a, b, n); }
+inline void vox_and(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) { vox_and_scalar(dst, a, b, n); }
+inline void vox_xor(VoxelCube *dst, const VoxelCube *a, const VoxelCube *b, size_t n) { vox_xor_scalar(dst, a, b, n); }
+inline void vox_popcount(uint32_t *count, const VoxelCube *a, size_t n) { vox_popcount_scalar(count, a, n); }
+
+#endif
+
+#endif
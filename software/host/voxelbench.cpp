@@ -0,0 +1,132 @@
+// voxelbench - times the batch kernels of voxel.h, scalar against the SIMD
+// path the build targets, and the transpose rotations against per voxel
+// get/set. Every result is checked against the scalar/reference output.
+//
+// usage: voxelbench [-n cubes] [-i iterations]
+//
+//   -n cubes       cubes per batch call (default 4096, 256 KB per array)
+//   -i iterations  calls per timing, the best of 5 timings is reported
+//                  (default 200)
+//
+// Build with -mavx2 (or -march=native) for the AVX2 kernels, SSE2 is the
+// x86-64 baseline.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "voxel.h"
+
+// the compile time API has to work at compile time
+static_assert(rotate_z(rotate_z(rotate_z(rotate_z(VoxelCube())))) == VoxelCube(), "constexpr rotation");
+static_assert(transpose8(transpose8(0x0123456789ABCDEFull)) == 0x0123456789ABCDEFull, "constexpr transpose");
+static_assert([] {
+    VoxelCube c;
+    c.set(1, 2, 3, true);
+    return c.get(1, 2, 3) && c.rows[3 * 8 + 2] == 0x02 && rotate_z(c).get(5, 1, 3);
+}(), "constexpr set/get");
+
+static unsigned iterations = 200;
+
+///////////////////////////////////////////////////////////
+// best of 5 timings of `iterations` calls, ns per cube
+static double best_ns(size_t n, const std::function<void()> &f)
+{
+    double best = 1e30;
+    for (int k = 0; k < 5; k++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++)
+            f();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        if (ns < best)
+            best = ns;
+    }
+    return best / iterations / n;
+}
+
+static void report(const char *name, double scalar, double fast, bool ok)
+{
+    std::printf("%-12s %10.2f %10.2f %8.2fx %8.2f  %s\n", name, scalar, fast, scalar / fast,
+                64.0 / fast, ok ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char **argv)
+{
+    size_t n = 4096;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            n = std::atoi(argv[++i]);
+        else if (arg == "-i" && i + 1 < argc)
+            iterations = std::atoi(argv[++i]);
+        else {
+            std::cerr << "usage: voxelbench [-n cubes] [-i iterations]\n";
+            return 1;
+        }
+    }
+    if (n == 0 || iterations == 0) {
+        std::cerr << "usage: voxelbench [-n cubes] [-i iterations]\n";
+        return 1;
+    }
+
+    std::mt19937 rng(1);
+    std::vector<VoxelCube> a(n), b(n), out(n), ref(n);
+    for (size_t i = 0; i < n; i++)
+        for (unsigned k = 0; k < 64; k++) {
+            a[i].rows[k] = (unsigned char)rng();
+            b[i].rows[k] = (unsigned char)rng();
+        }
+    std::vector<uint32_t> cnt(n), cnt_ref(n);
+
+#if defined(__AVX2__)
+    const char *path = "AVX2";
+#elif defined(__SSE2__)
+    const char *path = "SSE2";
+#else
+    const char *path = "none (scalar)";
+#endif
+    std::printf("%zu cubes per call, SIMD path: %s\n", n, path);
+    std::printf("%-12s %10s %10s %9s %8s\n", "kernel", "scalar ns", "fast ns", "speedup", "GB/s");
+
+    struct Op {
+        const char *name;
+        void (*scalar)(VoxelCube *, const VoxelCube *, const VoxelCube *, size_t);
+        void (*fast)(VoxelCube *, const VoxelCube *, const VoxelCube *, size_t);
+    } ops[] = {
+        {"or", vox_or_scalar, vox_or},
+        {"and", vox_and_scalar, vox_and},
+        {"xor", vox_xor_scalar, vox_xor},
+    };
+    for (const Op &op : ops) {
+        double s = best_ns(n, [&] { op.scalar(ref.data(), a.data(), b.data(), n); });
+        double f = best_ns(n, [&] { op.fast(out.data(), a.data(), b.data(), n); });
+        report(op.name, s, f, out == ref);
+    }
+
+    double s = best_ns(n, [&] { vox_popcount_scalar(cnt_ref.data(), a.data(), n); });
+    double f = best_ns(n, [&] { vox_popcount(cnt.data(), a.data(), n); });
+    report("popcount", s, f, cnt == cnt_ref);
+
+    // rotations: reference = get/set per voxel, fast = transposes
+    for (char axis : {'x', 'y', 'z'}) {
+        unsigned saved = iterations;
+        iterations = saved / 20 ? saved / 20 : 1; // the reference is slow
+        s = best_ns(n, [&] {
+            for (size_t i = 0; i < n; i++)
+                ref[i] = rotate_ref(a[i], axis);
+        });
+        iterations = saved;
+        f = best_ns(n, [&] { vox_rotate(out.data(), a.data(), n, axis, 1); });
+        std::string name = std::string("rotate ") + axis;
+        // four quarter turns must give the cube back
+        std::vector<VoxelCube> back(n);
+        vox_rotate(back.data(), a.data(), n, axis, 4);
+        report(name.c_str(), s, f, out == ref && back == a);
+    }
+    return 0;
+}